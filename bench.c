@@ -0,0 +1,367 @@
+/**
+ * Benchmark suite for the singly linked list library
+ * @file bench.c
+ * Usage: bench [--max-size N] [--trials N] [--format csv|json] [--op NAME] [--tmp PATH]
+ *              [--crossover]
+ *
+ * Every operation is run at sizes 1e3, 1e4, ... up to --max-size (default 1e6,
+ * up to 1e7 is practical) on lists built from randomUnique(), randomArray(),
+ * sorted and reverse-sorted data. Each configuration gets one untimed warm-up
+ * followed by --trials timed runs (default 5), reporting the median and p99
+ * time and the median in nanoseconds per element. Operations that are O(n^2)
+ * are only run up to QUADRATIC_MAX elements. --op restricts the run to one
+ * operation by name. The count, ulCount and simdCount rows compare scanning a
+ * node_t list, an unrolled list and a flat array, the last being the memory
+ * bandwidth ceiling the unrolled scan is measured against. The dlistSort row
+ * sorts the same values as doubles in an SLLIST_DEFINE list, comparing the
+ * generated code against naturalMergeSort().
+ *
+ * --crossover instead times mergeSort(), naturalMergeSort() and arraySort() on
+ * random lists of 2 to 65536 elements and reports the smallest size from which
+ * arraySort() stays faster than naturalMergeSort(), the sort hybridSort() uses
+ * below HYBRID_SORT_THRESHOLD, which is what the threshold should be set to.
+ *
+ * Build from the repository root with:
+ *     cc -O2 -std=c11 -o bench bench.c sllist.c stats.c rng.c ullist.c simd.c
+ * Add -DSLLIST_STATS to record operation counters. simd.c compiles its SSE2 and
+ * AVX2 kernels with target attributes and picks one at runtime, so no -mavx2 or
+ * -march flag is needed and the binary also runs on CPUs without AVX2.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sllist.h"
+#include "ullist.h"
+#include "simd.h"
+#include "sllist_generic.h"
+
+#define QUADRATIC_MAX 10000     // Largest size for O(n^2) operations
+#define MAX_TRIALS 1000
+
+SLLIST_DEFINE(dlist, double, SLLIST_CMP)
+
+/**
+ * A struct holding the data one benchmark operation works on.
+*/
+typedef struct state {
+    int* arr;               /**< Input values */
+    int size;               /**< Number of input values */
+    node_t* list;           /**< List built by setup or by the operation */
+    sllist_t handle;        /**< List handle built by setup or by the operation */
+    slab_t* blocks;         /**< Node blocks owned by the list, if built in bulk */
+    ullist_t unrolled;      /**< Unrolled list built by setup */
+    dlist_node_t* dlist;    /**< Generic list of doubles built by setup */
+    const char* path;       /**< Scratch file for save/load operations */
+} state_t;
+
+/**
+ * A struct describing one benchmarked operation. Only run() is timed.
+*/
+typedef struct bench {
+    const char* name;
+    int quadratic;                  /**< Non-zero if the operation is O(n^2) */
+    void (*setup)(state_t*);
+    void (*run)(state_t*);
+} bench_t;
+
+// Returns a monotonic timestamp in seconds.
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Setup functions (untimed).
+static void setupNone(state_t* s) {
+    (void)s;
+}
+
+static void setupList(state_t* s) {
+    s->list = createfromArray(s->arr, s->size);
+}
+
+static void setupUnrolled(state_t* s) {
+    ulFromArray(&s->unrolled, s->arr, s->size);
+}
+
+static void setupDoubleList(state_t* s) {
+    for (int i = s->size - 1; i >= 0; i--) dlist_push(&s->dlist, s->arr[i]);
+}
+
+static void setupHandle(state_t* s) {
+    initList(&s->handle);
+    for (int i = 0; i < s->size; i++) listEnqueue(&s->handle, s->arr[i]);
+}
+
+// Sorting relinks nodes, leaving them scattered relative to traversal order
+static void setupScattered(state_t* s) {
+    setupList(s);
+    mergeSort(&s->list);
+}
+
+static void setupCompacted(state_t* s) {
+    setupScattered(s);
+    compactList(&s->list, &s->blocks);
+}
+
+static void setupTextFile(state_t* s) {
+    setupList(s);
+    savetoFile(s->list, (char*)s->path);
+    destroy(&s->list);
+}
+
+static void setupBinaryFile(state_t* s) {
+    setupList(s);
+    savetoBinary(s->list, (char*)s->path);
+    destroy(&s->list);
+}
+
+// Timed operations.
+static void runCreate(state_t* s) { s->list = createfromArray(s->arr, s->size); }
+static void runCreateBlock(state_t* s) { s->list = createfromArrayBlock(s->arr, s->size, &s->blocks); }
+static void runPush(state_t* s) { for (int i = 0; i < s->size; i++) push(&s->list, s->arr[i]); }
+static void runEnqueue(state_t* s) { for (int i = 0; i < s->size; i++) enqueue(&s->list, s->arr[i]); }
+static void runPop(state_t* s) { while (s->list != NULL) pop(&s->list); }
+static void runRemoveTail(state_t* s) { removeTail(&s->list); }
+static void runDeleteMatch(state_t* s) { deleteMatch(&s->list, s->arr[s->size / 2]); }
+static void runDeleteDuplicates(state_t* s) { deleteDuplicates(&s->list); }
+static void runDeleteDuplicatesHash(state_t* s) { deleteDuplicatesHash(&s->list); }
+static void runReverse(state_t* s) { reverseList(&s->list); }
+static void runMergeSort(state_t* s) { mergeSort(&s->list); }
+static void runNaturalMergeSort(state_t* s) { naturalMergeSort(&s->list); }
+static void runRadixSort(state_t* s) { radixSort(&s->list); }
+static void runArraySort(state_t* s) { arraySort(&s->list); }
+static void runHybridSort(state_t* s) { hybridSort(&s->list); }
+static void runDlistSort(state_t* s) { dlist_sort(&s->dlist); }
+static void runCount(state_t* s) { count(s->list, s->arr[0]); }
+static void runUlCount(state_t* s) { ulCount(&s->unrolled, s->arr[0]); }
+static void runSimdCount(state_t* s) { simdCount(s->arr, s->size, s->arr[0]); }
+static void runLength(state_t* s) { length(s->list); }
+static void runCompact(state_t* s) { compactList(&s->list, &s->blocks); }
+static void runSave(state_t* s) { savetoFile(s->list, (char*)s->path); }
+static void runSaveFast(state_t* s) { savetoFileFast(s->list, (char*)s->path, 0); }
+static void runLoad(state_t* s) { s->list = createfromFile((char*)s->path); }
+static void runSaveBinary(state_t* s) { savetoBinary(s->list, (char*)s->path); }
+static void runLoadBinary(state_t* s) { s->list = createfromBinary((char*)s->path); }
+
+static void runLoadStream(state_t* s) {
+    FILE* file = fopen(s->path, "r");
+    if (file == NULL) return;
+    s->list = createfromStream(file);
+    fclose(file);
+}
+
+static void runListEnqueue(state_t* s) {
+    initList(&s->handle);
+    for (int i = 0; i < s->size; i++) listEnqueue(&s->handle, s->arr[i]);
+}
+
+static void runListPop(state_t* s) { while (s->handle.head != NULL) listPop(&s->handle); }
+
+static const bench_t benches[] = {
+    { "createfromArray", 0, setupNone, runCreate },
+    { "createfromArrayBlock", 0, setupNone, runCreateBlock },
+    { "push", 0, setupNone, runPush },
+    { "enqueue", 1, setupNone, runEnqueue },
+    { "listEnqueue", 0, setupNone, runListEnqueue },
+    { "pop", 0, setupList, runPop },
+    { "listPop", 0, setupHandle, runListPop },
+    { "removeTail", 0, setupList, runRemoveTail },
+    { "deleteMatch", 0, setupList, runDeleteMatch },
+    { "deleteDuplicates", 1, setupList, runDeleteDuplicates },
+    { "deleteDuplicatesHash", 0, setupList, runDeleteDuplicatesHash },
+    { "reverseList", 0, setupList, runReverse },
+    { "mergeSort", 0, setupList, runMergeSort },
+    { "naturalMergeSort", 0, setupList, runNaturalMergeSort },
+    { "radixSort", 0, setupList, runRadixSort },
+    { "arraySort", 0, setupList, runArraySort },
+    { "hybridSort", 0, setupList, runHybridSort },
+    { "dlistSort", 0, setupDoubleList, runDlistSort },
+    { "count", 0, setupList, runCount },
+    { "ulCount", 0, setupUnrolled, runUlCount },
+    { "simdCount", 0, setupNone, runSimdCount },
+    { "length", 0, setupList, runLength },
+    { "compactList", 0, setupScattered, runCompact },
+    { "lengthAfterSort", 0, setupScattered, runLength },
+    { "lengthAfterCompact", 0, setupCompacted, runLength },
+    { "savetoFile", 0, setupList, runSave },
+    { "savetoFileFast", 0, setupList, runSaveFast },
+    { "createfromFile", 0, setupTextFile, runLoad },
+    { "createfromStream", 0, setupTextFile, runLoadStream },
+    { "savetoBinary", 0, setupList, runSaveBinary },
+    { "createfromBinary", 0, setupBinaryFile, runLoadBinary },
+};
+
+static const char* input_names[] = { "randomUnique", "randomArray", "sorted", "reversed" };
+
+// Fills arr with one of the input distributions.
+static void fillInput(int arr[], int size, int input) {
+    switch (input) {
+        case 0: randomUnique(arr, size); break;
+        case 1: randomArray(arr, size, 0, size); break;     // Roughly 37% duplicates
+        case 2: for (int i = 0; i < size; i++) arr[i] = i; break;
+        default: for (int i = 0; i < size; i++) arr[i] = size - i; break;
+    }
+}
+
+// Frees whatever a run left behind (untimed).
+static void teardown(state_t* s) {
+    if (s->blocks != NULL) {        // Bulk-built nodes are released with their blocks
+        releaseBlocks(&s->blocks);
+        s->list = NULL;
+    }
+    if (s->list != NULL) destroy(&s->list);
+    listDestroy(&s->handle);
+    ulDestroy(&s->unrolled);
+    dlist_destroy(&s->dlist);
+}
+
+// Comparison function for qsort.
+static int compareDouble(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+#define CROSSOVER_WORK (1 << 20)     // Elements sorted per size and algorithm in --crossover
+
+// Returns the median time per element of sorting fresh lists of arr with sort.
+static double timeSort(void (*sort)(state_t*), state_t* s, int trials, double times[]) {
+    int reps = CROSSOVER_WORK / s->size;
+    for (int t = -1; t < trials; t++) {     // t == -1 is the warm-up
+        double elapsed = 0;
+        for (int r = 0; r < reps; r++) {
+            s->list = createfromArray(s->arr, s->size);
+            double start = now();
+            sort(s);
+            elapsed += now() - start;
+            destroy(&s->list);
+        }
+        if (t >= 0) times[t] = elapsed / reps;
+    }
+    qsort(times, trials, sizeof(double), compareDouble);
+    return times[(trials - 1) / 2] * 1e9 / s->size;
+}
+
+// Times the list sorts against arraySort() by size and reports the crossover.
+static int crossover(int trials, int json) {
+    static int arr[1 << 16];
+    double times[MAX_TRIALS];
+    int found = 0;      // Smallest size from which arraySort() beats naturalMergeSort() throughout
+    if (json) printf("[\n");
+    else printf("size,mergeSort_ns_per_element,naturalMergeSort_ns_per_element,arraySort_ns_per_element\n");
+
+    // Steps of about 1.5x resolve the crossover among small sizes
+    for (int size = 2; size <= (1 << 16); size += size < 4 ? 1 : size / 2) {
+        state_t s = { arr, size, NULL, { NULL, NULL, 0 }, NULL, { NULL, NULL, 0 }, NULL, NULL };
+        randomUnique(arr, size);
+        double merge = timeSort(runMergeSort, &s, trials, times);
+        double natural = timeSort(runNaturalMergeSort, &s, trials, times);
+        double array = timeSort(runArraySort, &s, trials, times);
+        if (array >= natural) found = 0;
+        else if (!found) found = size;
+        if (json) {
+            printf("%s  {\"size\": %d, \"mergeSort_ns_per_element\": %.3f, "
+                   "\"naturalMergeSort_ns_per_element\": %.3f, \"arraySort_ns_per_element\": %.3f}",
+                   size > 2 ? ",\n" : "", size, merge, natural, array);
+        }
+        else printf("%d,%.3f,%.3f,%.3f\n", size, merge, natural, array);
+        fflush(stdout);
+    }
+    if (json) printf("\n]\n");
+    fprintf(stderr, "crossover: %d (HYBRID_SORT_THRESHOLD is %d)\n", found, HYBRID_SORT_THRESHOLD);
+    return 0;
+}
+
+// Runs one configuration: a warm-up, then trials timed runs.
+static void measure(const bench_t* b, state_t* s, int trials, double times[]) {
+    for (int t = -1; t < trials; t++) {     // t == -1 is the warm-up
+        s->list = NULL;
+        initList(&s->handle);
+        ulInit(&s->unrolled);
+        b->setup(s);
+        double start = now();
+        b->run(s);
+        double elapsed = now() - start;
+        teardown(s);
+        if (t >= 0) times[t] = elapsed;
+    }
+    qsort(times, trials, sizeof(double), compareDouble);
+}
+
+int main(int argc, char* argv[]) {
+    int max_size = 1000000;
+    int trials = 5;
+    int json = 0;
+    const char* only = NULL;
+    const char* path = "/tmp/sllist_bench.tmp";
+    int cross = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--max-size") && i + 1 < argc) max_size = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--trials") && i + 1 < argc) trials = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--format") && i + 1 < argc) json = !strcmp(argv[++i], "json");
+        else if (!strcmp(argv[i], "--op") && i + 1 < argc) only = argv[++i];
+        else if (!strcmp(argv[i], "--tmp") && i + 1 < argc) path = argv[++i];
+        else if (!strcmp(argv[i], "--crossover")) cross = 1;
+        else {
+            fprintf(stderr, "Usage: %s [--max-size N] [--trials N] [--format csv|json] "
+                            "[--op NAME] [--tmp PATH] [--crossover]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (trials < 1 || trials > MAX_TRIALS || max_size < 1000) {
+        fprintf(stderr, "Error: trials must be 1-%d and max-size at least 1000\n", MAX_TRIALS);
+        return 1;
+    }
+
+    randomSeed(42);                 // Fixed seed for repeatable inputs
+    if (cross) return crossover(trials, json);
+    double times[MAX_TRIALS];
+    int first = 1;
+    if (json) printf("[\n");
+    else printf("op,input,size,trials,median_ns,p99_ns,ns_per_element\n");
+
+    for (int size = 1000; ; size *= 10) {
+        state_t s = { malloc(sizeof(int) * size), size, NULL, { NULL, NULL, 0 }, NULL, { NULL, NULL, 0 }, NULL, path };
+        if (s.arr == NULL) {
+            fprintf(stderr, "Error: Memory allocation failed for size %d\n", size);
+            return 1;
+        }
+
+        for (int input = 0; input < 4; input++) {
+            fillInput(s.arr, size, input);
+            for (size_t b = 0; b < sizeof(benches) / sizeof(benches[0]); b++) {
+                if (only != NULL && strcmp(only, benches[b].name)) continue;
+                if (benches[b].quadratic && size > QUADRATIC_MAX) continue;
+
+                measure(&benches[b], &s, trials, times);
+                double median = times[(trials - 1) / 2] * 1e9;
+                double p99 = times[(trials * 99 + 99) / 100 - 1] * 1e9;    // Nearest rank
+
+                if (json) {
+                    printf("%s  {\"op\": \"%s\", \"input\": \"%s\", \"size\": %d, \"trials\": %d, "
+                           "\"median_ns\": %.0f, \"p99_ns\": %.0f, \"ns_per_element\": %.3f}",
+                           first ? "" : ",\n", benches[b].name, input_names[input], size, trials,
+                           median, p99, median / size);
+                }
+                else {
+                    printf("%s,%s,%d,%d,%.0f,%.0f,%.3f\n", benches[b].name, input_names[input],
+                           size, trials, median, p99, median / size);
+                }
+                first = 0;
+                fflush(stdout);
+            }
+        }
+        free(s.arr);
+        if (size > max_size / 10) break;    // size * 10 would pass max_size or overflow int
+    }
+
+    if (json) printf("\n]\n");
+    remove(path);
+    return 0;
+}
@@ -0,0 +1,432 @@
+/**
+ * Throughput benchmark and stress check for the lock-free containers
+ * @file bench_concurrent.c
+ * Usage: bench_concurrent [max_threads] [ops_per_thread]
+ * Thread counts double from 1 up to max_threads. Queue runs use that many
+ * producers and that many consumers. Every run verifies that the values
+ * removed equal the values added, push/pop runs check that each value comes
+ * out exactly once, and queue runs also verify that each
+ * consumer sees every producer's values in the order they were enqueued.
+ * The persistent list run has that many readers taking snapshots while one
+ * writer publishes versions; it checks every snapshot's contents and that
+ * no reference is left behind once the readers finish. Built with
+ * -DSLLIST_STATS, it also checks that every node is freed at the end.
+ *
+ * Build from the repository root with:
+ *     cc -O2 -std=c11 -pthread -o bench_concurrent bench_concurrent.c sllist.c stats.c \
+ *        rng.c lfstack.c lfqueue.c lfarena.c plist.c
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include "sllist.h"
+#include "lfstack.h"
+#include "lfqueue.h"
+#include "plist.h"
+#include "stats.h"
+
+/**
+ * A struct holding the shared state of one benchmark run.
+*/
+typedef struct run {
+    int ops;                    /**< Push/pop pairs per thread */
+    node_t* list;               /**< Mutex-wrapped list */
+    pthread_mutex_t lock;       /**< Global lock around push()/pop() */
+    lfstack_t* stack;           /**< Lock-free stack */
+    sllist_t queue;             /**< Mutex-wrapped list handle used as a queue */
+    lfqueue_t* lfqueue;         /**< Lock-free queue */
+    _Atomic long long consumed; /**< Items dequeued so far across all consumers */
+    _Atomic long long total;    /**< Items the producers will enqueue in total */
+    plroot_t root;              /**< Slot the persistent list writer publishes to */
+    plist_t* version;           /**< Writer's last published version */
+    _Atomic int writing;        /**< Non-zero while the persistent list writer runs */
+    _Atomic int readers;        /**< Persistent list readers that have started */
+    unsigned char* seen;        /**< Push/pop runs: values accounted for, indexed by value */
+} run_t;
+
+/**
+ * A struct holding the per-thread arguments and results.
+*/
+typedef struct worker {
+    run_t* run;
+    int id;
+    long long pushed;           /**< Sum of values pushed */
+    long long popped;           /**< Sum of values popped, or snapshots taken by a reader */
+    int* last;                  /**< Consumer: last sequence number seen per producer */
+    int failed;                 /**< Set when a consumer or reader sees an invalid value */
+    int* values;                /**< Push/pop worker: values popped, in order */
+    int count;                  /**< Push/pop worker: number of entries in values */
+} worker_t;
+
+// Returns a monotonic timestamp in seconds.
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Alternates push and pop on the mutex-wrapped node_t list.
+static void* mutexWorker(void* arg) {
+    worker_t* w = arg;
+    run_t* run = w->run;
+    for (int i = 0; i < run->ops; i++) {
+        int value = w->id * run->ops + i;
+        pthread_mutex_lock(&run->lock);
+        int error = push(&run->list, value);
+        pthread_mutex_unlock(&run->lock);
+        if (error == 0) w->pushed += value;
+        else run->seen[value] = 1;          // Never pushed, so not expected back
+
+        pthread_mutex_lock(&run->lock);
+        if (run->list != NULL) {
+            w->popped += run->list->data;
+            w->values[w->count++] = run->list->data;
+            pop(&run->list);
+        }
+        pthread_mutex_unlock(&run->lock);
+    }
+    return NULL;
+}
+
+// Alternates push and pop on the lock-free stack.
+static void* stackWorker(void* arg) {
+    worker_t* w = arg;
+    run_t* run = w->run;
+    for (int i = 0; i < run->ops; i++) {
+        int value = w->id * run->ops + i;
+        if (lfsPush(run->stack, value) == 0) w->pushed += value;
+        else run->seen[value] = 1;          // Never pushed, so not expected back
+
+        int data;
+        if (lfsPop(run->stack, &data) == 0) {
+            w->popped += data;
+            w->values[w->count++] = data;
+        }
+    }
+    return NULL;
+}
+
+// Producer: enqueues ops values through the mutex-wrapped list handle.
+static void* mutexProducer(void* arg) {
+    worker_t* w = arg;
+    run_t* run = w->run;
+    for (int i = 0; i < run->ops; i++) {
+        int value = w->id * run->ops + i;
+        pthread_mutex_lock(&run->lock);
+        if (listEnqueue(&run->queue, value) == 0) w->pushed += value;
+        else atomic_fetch_sub(&run->total, 1);
+        pthread_mutex_unlock(&run->lock);
+    }
+    return NULL;
+}
+
+// Records a dequeued value, flagging it if its producer's sequence went backwards.
+static void recordValue(worker_t* w, int value) {
+    int producer = value / w->run->ops;
+    int seq = value % w->run->ops;
+    if (seq <= w->last[producer]) w->failed = 1;
+    w->last[producer] = seq;
+    w->popped += value;
+}
+
+// Consumer: dequeues through the mutex-wrapped list handle until all items are seen.
+static void* mutexConsumer(void* arg) {
+    worker_t* w = arg;
+    run_t* run = w->run;
+    while (atomic_load(&run->consumed) < run->total) {
+        pthread_mutex_lock(&run->lock);
+        if (run->queue.head != NULL) {
+            recordValue(w, run->queue.head->data);
+            listPop(&run->queue);
+            atomic_fetch_add(&run->consumed, 1);
+        }
+        pthread_mutex_unlock(&run->lock);
+    }
+    return NULL;
+}
+
+// Producer: enqueues ops values on the lock-free queue.
+static void* queueProducer(void* arg) {
+    worker_t* w = arg;
+    run_t* run = w->run;
+    for (int i = 0; i < run->ops; i++) {
+        int value = w->id * run->ops + i;
+        while (lfqEnqueue(run->lfqueue, value) != 0);   // Retry on allocation failure
+        w->pushed += value;
+    }
+    return NULL;
+}
+
+// Consumer: dequeues from the lock-free queue until all items are seen.
+static void* queueConsumer(void* arg) {
+    worker_t* w = arg;
+    run_t* run = w->run;
+    int data;
+    while (atomic_load(&run->consumed) < run->total) {
+        if (lfqDequeue(run->lfqueue, &data) == 0) {
+            recordValue(w, data);
+            atomic_fetch_add(&run->consumed, 1);
+        }
+    }
+    return NULL;
+}
+
+// Runs threads producers and threads consumers, returning Mitems/s or -1 on a failed check.
+static double measureQueue(void* (*producer)(void*), void* (*consumer)(void*), run_t* run,
+                           int threads) {
+    pthread_t tids[2 * threads];
+    worker_t workers[2 * threads];
+    int* last = malloc(sizeof(int) * threads * threads);
+    if (last == NULL) return -1;
+    atomic_store(&run->total, (long long)threads * run->ops);
+    atomic_store(&run->consumed, 0);
+    for (int i = 0; i < threads * threads; i++) last[i] = -1;
+
+    double start = now();
+    for (int t = 0; t < 2 * threads; t++) {
+        workers[t] = (worker_t){ run, t % threads, 0, 0,
+                                 t < threads ? NULL : last + (t - threads) * threads, 0, NULL, 0 };
+        pthread_create(&tids[t], NULL, t < threads ? producer : consumer, &workers[t]);
+    }
+    for (int t = 0; t < 2 * threads; t++) {
+        pthread_join(tids[t], NULL);
+    }
+    double elapsed = now() - start;
+
+    long long pushed = 0, popped = 0;
+    int failed = 0;
+    for (int t = 0; t < 2 * threads; t++) {
+        pushed += workers[t].pushed;
+        popped += workers[t].popped;
+        failed |= workers[t].failed;
+    }
+    free(last);
+    if (pushed != popped || failed) return -1;
+
+    return (double)atomic_load(&run->total) / elapsed / 1e6;
+}
+
+#define PLIST_DEPTH 64     // Writer grows the list to this length, then pops it back to empty
+
+// Writer: publishes ops versions, each counting down from its length to 1.
+static void* plistWriter(void* arg) {
+    worker_t* w = arg;
+    run_t* run = w->run;
+    plist_t* current = NULL;
+    int length = 0;
+    while (atomic_load(&run->readers) < w->id) sched_yield();     // The writer's id is the reader count
+    for (int i = 0; i < run->ops; i++) {
+        // Let readers in between phases, so snapshots overlap pops even on one CPU
+        if (i % PLIST_DEPTH == 0) sched_yield();
+        plist_t* next;
+        if ((i / PLIST_DEPTH) % 2 == 0) {   // Sawtooth, so pops free nodes snapshots may hold
+            next = plPush(current, length + 1);
+            if (next == NULL) {
+                w->failed = 1;
+                break;
+            }
+            length++;
+        }
+        else {
+            next = plPop(current);
+            length--;
+        }
+        plRelease(&current);
+        current = next;
+        plPublish(&run->root, current);
+    }
+    run->version = current;
+    atomic_store(&run->writing, 0);
+    return NULL;
+}
+
+// Reader: takes snapshots until the writer finishes, checking each is a whole version.
+static void* plistReader(void* arg) {
+    worker_t* w = arg;
+    run_t* run = w->run;
+    atomic_fetch_add(&run->readers, 1);
+    while (atomic_load(&run->writing)) {
+        plist_t* view = plSnapshot(&run->root);
+        int expected = plLength(view);
+        int data;
+        for (plist_t* node = view; node != NULL; node = plNext(node)) {
+            if (plHead(node, &data) != 0 || data != expected--) w->failed = 1;
+        }
+        plRelease(&view);
+        w->popped++;
+    }
+    return NULL;
+}
+
+// Returns mallocs minus frees across all operations; 0 unless built with SLLIST_STATS.
+static long long liveAllocations(void) {
+    opstats_t stats[STAT_OPS];
+    statsSnapshot(stats);
+    long long live = 0;
+    for (int op = 0; op < STAT_OPS; op++) live += stats[op].mallocs - stats[op].frees;
+    return live;
+}
+
+// Runs threads readers against one writer, returning Msnapshots/s or -1 on a failed check.
+static double measurePersistent(run_t* run, int threads) {
+    pthread_t tids[threads + 1];
+    worker_t workers[threads + 1];
+    long long live = liveAllocations();
+    plRootInit(&run->root);
+    atomic_store(&run->writing, 1);
+    atomic_store(&run->readers, 0);
+
+    double start = now();
+    for (int t = 0; t <= threads; t++) {
+        workers[t] = (worker_t){ run, t, 0, 0, NULL, 0, NULL, 0 };
+        pthread_create(&tids[t], NULL, t < threads ? plistReader : plistWriter, &workers[t]);
+    }
+    for (int t = 0; t <= threads; t++) {
+        pthread_join(tids[t], NULL);
+    }
+    double elapsed = now() - start;
+
+    long long snapshots = 0;
+    int failed = 0;
+    for (int t = 0; t <= threads; t++) {
+        if (t < threads) snapshots += workers[t].popped;
+        failed |= workers[t].failed;
+    }
+    // Readers have released every snapshot: the head is held by the writer and
+    // the slot, and every other node only by the node before it
+    for (plist_t* node = run->version; node != NULL; node = plNext(node)) {
+        if (plRefs(node) != (node == run->version ? 2 : 1)) failed = 1;
+    }
+    plRootDestroy(&run->root);
+    plRelease(&run->version);
+    if (failed || liveAllocations() != live) return -1;
+
+    return (double)snapshots / elapsed / 1e6;
+}
+
+// Marks value as removed, returning 1 if it is out of range or was already removed.
+static int markSeen(run_t* run, int total, int value) {
+    if (value < 0 || value >= total || run->seen[value]) return 1;
+    run->seen[value] = 1;
+    return 0;
+}
+
+// Runs one benchmark with the given worker, returning Mops/s or -1 on a failed check.
+static double measure(void* (*fn)(void*), run_t* run, int threads) {
+    pthread_t tids[threads];
+    worker_t workers[threads];
+    int total = threads * run->ops;     // main() keeps this within INT_MAX
+    int* values = malloc(sizeof(int) * total);
+    run->seen = calloc(total, 1);
+    if (values == NULL || run->seen == NULL) {
+        free(values);
+        free(run->seen);
+        return -1;
+    }
+
+    double start = now();
+    for (int t = 0; t < threads; t++) {
+        workers[t] = (worker_t){ run, t, 0, 0, NULL, 0, values + (size_t)t * run->ops, 0 };
+        pthread_create(&tids[t], NULL, fn, &workers[t]);
+    }
+    for (int t = 0; t < threads; t++) {
+        pthread_join(tids[t], NULL);
+    }
+    double elapsed = now() - start;
+
+    // Drain what is left, then check nothing was lost or duplicated
+    long long pushed = 0, popped = 0;
+    int failed = 0;
+    for (int t = 0; t < threads; t++) {
+        pushed += workers[t].pushed;
+        popped += workers[t].popped;
+        for (int k = 0; k < workers[t].count; k++) {
+            failed |= markSeen(run, total, workers[t].values[k]);
+        }
+    }
+    int data;
+    while (run->list != NULL) {
+        popped += run->list->data;
+        failed |= markSeen(run, total, run->list->data);
+        pop(&run->list);
+    }
+    while (run->stack != NULL && lfsPop(run->stack, &data) == 0) {
+        popped += data;
+        failed |= markSeen(run, total, data);
+    }
+    for (int v = 0; v < total; v++) {
+        failed |= !run->seen[v];
+    }
+    free(values);
+    free(run->seen);
+    run->seen = NULL;
+    if (pushed != popped || failed) return -1;
+
+    return 2.0 * threads * run->ops / elapsed / 1e6;
+}
+
+// Doubles the thread count, finishing exactly at max_threads.
+static int nextThreads(int threads, int max_threads) {
+    if (threads < max_threads && threads * 2 > max_threads) return max_threads;
+    return threads * 2;
+}
+
+int main(int argc, char* argv[]) {
+    int max_threads = argc > 1 ? atoi(argv[1]) : 4;
+    int ops = argc > 2 ? atoi(argv[2]) : 1000000;
+    if (max_threads < 1 || ops < 1) {
+        fprintf(stderr, "Usage: %s [max_threads] [ops_per_thread]\n", argv[0]);
+        return 1;
+    }
+    // Values are id * ops + i and must fit the int payload of every container
+    if ((long long)max_threads * ops > INT_MAX) {
+        fprintf(stderr, "Error: max_threads * ops_per_thread must not exceed %d\n", INT_MAX);
+        return 1;
+    }
+
+    printf("benchmark,threads,mops_per_sec\n");
+    for (int threads = 1; threads <= max_threads; threads = nextThreads(threads, max_threads)) {
+        run_t run = { .ops = ops, .lock = PTHREAD_MUTEX_INITIALIZER };
+        initList(&run.queue);
+        double mutex_rate = measure(mutexWorker, &run, threads);
+
+        run.stack = lfsCreate();
+        if (run.stack == NULL) {
+            fprintf(stderr, "Error: Unable to create the lock-free stack\n");
+            return 1;
+        }
+        double stack_rate = measure(stackWorker, &run, threads);
+        lfsDestroy(&run.stack);
+
+        // Queue runs use threads producers plus threads consumers
+        double mutex_queue_rate = measureQueue(mutexProducer, mutexConsumer, &run, threads);
+        run.lfqueue = lfqCreate();
+        if (run.lfqueue == NULL) {
+            fprintf(stderr, "Error: Unable to create the lock-free queue\n");
+            return 1;
+        }
+        double queue_rate = measureQueue(queueProducer, queueConsumer, &run, threads);
+        lfqDestroy(&run.lfqueue);
+
+        double snapshot_rate = measurePersistent(&run, threads);
+
+        if (mutex_rate < 0 || stack_rate < 0 || mutex_queue_rate < 0 || queue_rate < 0 ||
+            snapshot_rate < 0) {
+            fprintf(stderr, "Error: a consistency check failed with %d threads\n", threads);
+            return 1;
+        }
+        printf("mutex_push_pop,%d,%.2f\n", threads, mutex_rate);
+        printf("lfstack_push_pop,%d,%.2f\n", threads, stack_rate);
+        printf("mutex_enqueue_dequeue,%d,%.2f\n", threads, mutex_queue_rate);
+        printf("lfqueue_enqueue_dequeue,%d,%.2f\n", threads, queue_rate);
+        printf("plist_snapshot,%d,%.2f\n", threads, snapshot_rate);
+    }
+    return 0;
+}
@@ -0,0 +1,389 @@
+/**
+ * Index-linked list library
+ * @file ixlist.c
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <limits.h>
+#include "ixlist.h"
+
+#define IX_MAX_NODES INT_MAX    // Keeps length and every index representable
+
+// Grows the storage to at least size slots.
+static int grow(ixlist_t* list, uint32_t size) {
+    if (size <= list->capacity) return 0;
+    if (size > IX_MAX_NODES) {
+        fprintf(stderr, "Error: Index-linked list is full\n");
+        return 1;
+    }
+    ixnode_t* nodes = realloc(list->nodes, sizeof(ixnode_t) * size);
+    if (nodes == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for index-linked list\n");
+        return 1;
+    }
+    list->nodes = nodes;
+    list->capacity = size;
+    return 0;
+}
+
+// Takes a slot from the free list or the unused tail of the storage, or IX_NIL on failure.
+static uint32_t allocNode(ixlist_t* list, int data) {
+    uint32_t index = list->free_list;
+    if (index != IX_NIL) {
+        list->free_list = list->nodes[index].next;
+    }
+    else {
+        if (list->used == list->capacity) {
+            // Grow by half, so the slack is at most a third of the storage
+            uint64_t size = list->capacity < 16 ? 16 : list->capacity + list->capacity / 2;
+            if (size > IX_MAX_NODES) size = IX_MAX_NODES;
+            if (grow(list, (uint32_t)size)) return IX_NIL;
+        }
+        index = list->used++;
+    }
+    list->nodes[index].data = data;
+    list->nodes[index].next = IX_NIL;
+    list->length++;
+    return index;
+}
+
+// Returns a slot to the free list.
+static void freeNode(ixlist_t* list, uint32_t index) {
+    list->nodes[index].next = list->free_list;
+    list->free_list = index;
+    list->length--;
+}
+
+// Initialises an index-linked list to an empty list.
+void ixInit(ixlist_t* list) {
+    list->nodes = NULL;
+    list->capacity = 0;
+    list->used = 0;
+    list->free_list = IX_NIL;
+    list->head = IX_NIL;
+    list->tail = IX_NIL;
+    list->length = 0;
+}
+
+// Grows the node storage so that it holds at least size nodes.
+int ixReserve(ixlist_t* list, int size) {
+    return size > 0 ? grow(list, (uint32_t)size) : 0;
+}
+
+// Adds an element to the head of an index-linked list.
+int ixPush(ixlist_t* list, int data) {
+    uint32_t index = allocNode(list, data);
+    if (index == IX_NIL) return 1;
+    list->nodes[index].next = list->head;
+    list->head = index;
+    if (list->tail == IX_NIL) list->tail = index;
+    return 0;
+}
+
+// Adds an element to the tail of an index-linked list.
+int ixEnqueue(ixlist_t* list, int data) {
+    uint32_t index = allocNode(list, data);
+    if (index == IX_NIL) return 1;
+    if (list->tail == IX_NIL) list->head = index;
+    else list->nodes[list->tail].next = index;
+    list->tail = index;
+    return 0;
+}
+
+// Removes the element at the head of an index-linked list.
+int ixPop(ixlist_t* list) {
+    if (list->head == IX_NIL) {
+        fprintf(stderr, "Error: Cannot pop empty list.\n");
+        return 1;
+    }
+    uint32_t index = list->head;
+    list->head = list->nodes[index].next;
+    if (list->head == IX_NIL) list->tail = IX_NIL;
+    freeNode(list, index);
+    return 0;
+}
+
+// Removes the element at the tail of an index-linked list.
+int ixRemoveTail(ixlist_t* list) {
+    if (list->head == IX_NIL) {
+        fprintf(stderr, "Error: Cannot remove tail of empty list.\n");
+        return 1;
+    }
+    // Find the node before the tail
+    uint32_t prev = IX_NIL;
+    for (uint32_t i = list->head; i != list->tail; i = list->nodes[i].next) prev = i;
+    freeNode(list, list->tail);
+    list->tail = prev;
+    if (prev == IX_NIL) list->head = IX_NIL;
+    else list->nodes[prev].next = IX_NIL;
+    return 0;
+}
+
+// Deletes all elements with a matching value in an index-linked list.
+void ixDeleteMatch(ixlist_t* list, int value) {
+    ixnode_t* nodes = list->nodes;
+    uint32_t* link = &list->head;
+    uint32_t last = IX_NIL;
+    while (*link != IX_NIL) {
+        uint32_t index = *link;
+        if (nodes[index].data == value) {
+            *link = nodes[index].next;
+            freeNode(list, index);
+        }
+        else {
+            last = index;
+            link = &nodes[index].next;
+        }
+    }
+    list->tail = last;
+}
+
+// Deletes all duplicated elements, keeping the first occurrence of each value.
+int ixDeleteDuplicates(ixlist_t* list) {
+    if (list->length < 2) return 0;
+
+    intset_t seen;
+    if (intsetInit(&seen, (size_t)list->length)) {
+        fprintf(stderr, "Error: Memory allocation failed in ixDeleteDuplicates\n");
+        return 1;
+    }
+
+    ixnode_t* nodes = list->nodes;
+    uint32_t* link = &list->head;
+    uint32_t last = IX_NIL;
+    while (*link != IX_NIL) {
+        uint32_t index = *link;
+        if (intsetAdd(&seen, nodes[index].data)) {
+            *link = nodes[index].next;
+            freeNode(list, index);
+        }
+        else {
+            last = index;
+            link = &nodes[index].next;
+        }
+    }
+    list->tail = last;
+    intsetDestroy(&seen);
+    return 0;
+}
+
+// Reverses the order of an index-linked list.
+void ixReverse(ixlist_t* list) {
+    ixnode_t* nodes = list->nodes;
+    uint32_t prev = IX_NIL;
+    uint32_t index = list->head;
+    list->tail = index;
+    while (index != IX_NIL) {
+        uint32_t next = nodes[index].next;
+        nodes[index].next = prev;
+        prev = index;
+        index = next;
+    }
+    list->head = prev;
+}
+
+// Merges two sorted runs, taking from left on ties, and returns the head.
+static uint32_t mergeRuns(ixnode_t* nodes, uint32_t left, uint32_t left_tail,
+                          uint32_t right, uint32_t right_tail, uint32_t* tail) {
+    uint32_t head;
+    uint32_t* link = &head;
+    while (left != IX_NIL && right != IX_NIL) {
+        if (nodes[left].data <= nodes[right].data) {
+            *link = left;
+            link = &nodes[left].next;
+            left = *link;
+        }
+        else {
+            *link = right;
+            link = &nodes[right].next;
+            right = *link;
+        }
+    }
+    // Whichever run is left over keeps its own tail
+    if (left != IX_NIL) {
+        *link = left;
+        *tail = left_tail;
+    }
+    else {
+        *link = right;
+        *tail = right_tail;
+    }
+    return head;
+}
+
+// Sorts an index-linked list in ascending order by relinking its nodes.
+void ixMergeSort(ixlist_t* list) {
+    if (list->length < 2) return;
+    ixnode_t* nodes = list->nodes;
+
+    // Bin k holds a sorted run of about 2^k natural runs; earlier runs sit in higher bins
+    uint32_t bins[64], bin_tails[64];
+    int used = 0;
+    uint32_t rest = list->head;
+    while (rest != IX_NIL) {
+        uint32_t run = rest;
+        while (nodes[rest].next != IX_NIL && nodes[rest].data <= nodes[nodes[rest].next].data) {
+            rest = nodes[rest].next;
+        }
+        uint32_t run_tail = rest;
+        rest = nodes[rest].next;
+        nodes[run_tail].next = IX_NIL;
+
+        int k = 0;
+        for (; k < used && bins[k] != IX_NIL; k++) {
+            run = mergeRuns(nodes, bins[k], bin_tails[k], run, run_tail, &run_tail);
+            bins[k] = IX_NIL;
+        }
+        if (k == used) used++;
+        bins[k] = run;
+        bin_tails[k] = run_tail;
+    }
+
+    uint32_t result = IX_NIL, result_tail = IX_NIL;
+    for (int k = 0; k < used; k++) {
+        if (bins[k] == IX_NIL) continue;
+        if (result == IX_NIL) {
+            result = bins[k];
+            result_tail = bin_tails[k];
+        }
+        else result = mergeRuns(nodes, bins[k], bin_tails[k], result, result_tail, &result_tail);
+    }
+    list->head = result;
+    list->tail = result_tail;
+}
+
+// Counts the number of occurences of a given value in an index-linked list.
+int ixCount(ixlist_t* list, int value) {
+    int count = 0;
+    for (uint32_t i = list->head; i != IX_NIL; i = list->nodes[i].next) {
+        count += list->nodes[i].data == value;
+    }
+    return count;
+}
+
+// Returns the number of elements in an index-linked list.
+int ixLength(ixlist_t* list) {
+    return list->length;
+}
+
+// Prints all elements of an index-linked list.
+void ixPrint(ixlist_t* list) {
+    if (list->head == IX_NIL) {
+        printf("Empty list");
+        return;
+    }
+    for (uint32_t i = list->head; i != IX_NIL; i = list->nodes[i].next) {
+        printf("-%d", list->nodes[i].data);
+    }
+    printf("\n");
+}
+
+// Moves the nodes into traversal order and shrinks the storage to fit.
+int ixCompact(ixlist_t* list) {
+    if (list->length == 0) {
+        ixDestroy(list);
+        return 0;
+    }
+    uint32_t size = (uint32_t)list->length;
+    ixnode_t* nodes = malloc(sizeof(ixnode_t) * size);
+    if (nodes == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in ixCompact\n");
+        return 1;
+    }
+    uint32_t n = 0;
+    for (uint32_t i = list->head; i != IX_NIL; i = list->nodes[i].next, n++) {
+        nodes[n].data = list->nodes[i].data;
+        nodes[n].next = n + 1;
+    }
+    nodes[size - 1].next = IX_NIL;
+
+    free(list->nodes);
+    list->nodes = nodes;
+    list->capacity = size;
+    list->used = size;
+    list->free_list = IX_NIL;
+    list->head = 0;
+    list->tail = size - 1;
+    return 0;
+}
+
+// Destroys an index-linked list, deallocating its storage.
+void ixDestroy(ixlist_t* list) {
+    free(list->nodes);
+    ixInit(list);
+}
+
+// Appends the elements of an array to the tail of an index-linked list.
+int ixFromArray(ixlist_t* list, int arr[], int size) {
+    if (size > 0 && list->free_list == IX_NIL && ixReserve(list, (int)list->used + size)) return 1;
+    for (int i = 0; i < size; i++) {
+        if (ixEnqueue(list, arr[i])) return 1;
+    }
+    return 0;
+}
+
+// Copies the elements of an index-linked list into an array.
+int ixToArray(ixlist_t* list, int arr[]) {
+    int n = 0;
+    for (uint32_t i = list->head; i != IX_NIL; i = list->nodes[i].next) {
+        arr[n++] = list->nodes[i].data;
+    }
+    return n;
+}
+
+// Appends the elements of a linked list to the tail of an index-linked list.
+int ixFromList(ixlist_t* list, node_t* head) {
+    while (head != NULL) {
+        if (ixEnqueue(list, head->data)) return 1;
+        head = head->next;
+    }
+    return 0;
+}
+
+// Creates a linked list containing the elements of an index-linked list.
+node_t* ixToList(ixlist_t* list) {
+    sllist_t out;
+    initList(&out);
+    for (uint32_t i = list->head; i != IX_NIL; i = list->nodes[i].next) {
+        if (listEnqueue(&out, list->nodes[i].data)) {
+            listDestroy(&out);
+            return NULL;
+        }
+    }
+    return out.head;
+}
+
+// Saves an index-linked list to a file, one value per line.
+int ixSave(ixlist_t* list, char* filename) {
+    FILE* output = fopen(filename, "w");
+    if (output == NULL) {
+        fprintf(stderr, "Error: Unable to open file for writing.\n");
+        return 1;
+    }
+    int error = 0;
+    for (uint32_t i = list->head; i != IX_NIL && !error; i = list->nodes[i].next) {
+        error = fprintf(output, "%d\n", list->nodes[i].data) < 0;
+    }
+    if (fclose(output) != 0) error = 1;
+    if (error) fprintf(stderr, "Error: Failed to write list file.\n");
+    return error;
+}
+
+// Appends one scanned value to the index-linked list ctx.
+static int enqueueValue(void* ctx, int data) {
+    return ixEnqueue(ctx, data);
+}
+
+// Appends the values stored in a file to an index-linked list.
+int ixLoad(ixlist_t* list, char* filename) {
+    FILE* input = fopen(filename, "r");
+    if (input == NULL) {
+        fprintf(stderr, "Error: Unable to open file.\n");
+        return 1;
+    }
+    int error = scanStream(input, enqueueValue, list);
+    if (error) fprintf(stderr, "Error: Failed to read list file.\n");
+    fclose(input);
+    return error;
+}
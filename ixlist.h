@@ -0,0 +1,198 @@
+/**
+ * Index-linked list library
+ * @file ixlist.h
+ * Nodes live in one growable array and are linked by 32-bit indices instead of
+ * pointers, so each element takes 8 bytes (an int and an index) against 16 for
+ * a node_t plus its malloc header. Removed slots are kept on a free list and
+ * reused; ixCompact() returns the slack to the system. Indices stay valid when
+ * the array grows, unlike pointers into it.
+*/
+
+#ifndef IXLIST_H
+#define IXLIST_H
+
+#include <stdint.h>
+#include "sllist.h"
+
+#define IX_NIL UINT32_MAX   // Index marking the end of a list
+
+/**
+ * A struct representing a node in an index-linked list.
+*/
+typedef struct ixnode {
+    int data;           /**< Integer data stored in the node */
+    uint32_t next;      /**< Index of the next node, or IX_NIL */
+} ixnode_t;
+
+/**
+ * A struct representing an index-linked list.
+*/
+typedef struct ixlist {
+    ixnode_t* nodes;        /**< Node storage */
+    uint32_t capacity;      /**< Number of slots allocated */
+    uint32_t used;          /**< Number of slots ever handed out */
+    uint32_t free_list;     /**< Index of the first released slot, or IX_NIL */
+    uint32_t head;          /**< Index of the first node, or IX_NIL */
+    uint32_t tail;          /**< Index of the last node, or IX_NIL */
+    int length;             /**< Number of elements in the list */
+} ixlist_t;
+
+/**
+ * @brief Initialises an index-linked list to an empty list.
+ * @param list A pointer to the index-linked list.
+ */
+void ixInit(ixlist_t* list);
+
+/**
+ * @brief Grows the node storage so that it holds at least size nodes.
+ * Reserving up front avoids the slack left by geometric growth.
+ * @param list A pointer to the index-linked list.
+ * @param size The number of nodes to make room for.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int ixReserve(ixlist_t* list, int size);
+
+/**
+ * @brief Adds an element to the head of an index-linked list.
+ * @param list A pointer to the index-linked list.
+ * @param data An integer data to be stored.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int ixPush(ixlist_t* list, int data);
+
+/**
+ * @brief Adds an element to the tail of an index-linked list in O(1).
+ * @param list A pointer to the index-linked list.
+ * @param data An integer data to be stored.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int ixEnqueue(ixlist_t* list, int data);
+
+/**
+ * @brief Removes the element at the head of an index-linked list.
+ * @param list A pointer to the index-linked list.
+ * @return 0 upon successful completion, 1 otherwise
+ */
+int ixPop(ixlist_t* list);
+
+/**
+ * @brief Removes the element at the tail of an index-linked list.
+ * @param list A pointer to the index-linked list.
+ * @return 0 upon successful completion, 1 otherwise
+ */
+int ixRemoveTail(ixlist_t* list);
+
+/**
+ * @brief Deletes all elements with a matching value in an index-linked list.
+ * @param list A pointer to the index-linked list.
+ * @param value The value to be deleted from the list.
+ */
+void ixDeleteMatch(ixlist_t* list, int value);
+
+/**
+ * @brief Deletes all duplicated elements, keeping the first occurrence of each value.
+ * Runs in O(n) using the hash set behind deleteDuplicatesHash().
+ * @param list A pointer to the index-linked list.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure (list unchanged).
+ */
+int ixDeleteDuplicates(ixlist_t* list);
+
+/**
+ * @brief Reverses the order of an index-linked list.
+ * @param list A pointer to the index-linked list.
+ */
+void ixReverse(ixlist_t* list);
+
+/**
+ * @brief Sorts an index-linked list in ascending order by relinking its nodes.
+ * A stable natural merge sort, like naturalMergeSort().
+ * @param list A pointer to the index-linked list.
+ */
+void ixMergeSort(ixlist_t* list);
+
+/**
+ * @brief Counts the number of occurences of a given value in an index-linked list.
+ * @param list A pointer to the index-linked list.
+ * @param value The value to search for in the list.
+ * @return The number of occurences.
+ */
+int ixCount(ixlist_t* list, int value);
+
+/**
+ * @brief Returns the number of elements in an index-linked list.
+ * @param list A pointer to the index-linked list.
+ * @return The number of elements.
+ */
+int ixLength(ixlist_t* list);
+
+/**
+ * @brief Prints all elements of an index-linked list, in the same format as printList().
+ * @param list A pointer to the index-linked list.
+ */
+void ixPrint(ixlist_t* list);
+
+/**
+ * @brief Moves the nodes into traversal order and shrinks the storage to fit.
+ * Traversal becomes sequential and released slots are returned to the system.
+ * @param list A pointer to the index-linked list.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure (list unchanged).
+ */
+int ixCompact(ixlist_t* list);
+
+/**
+ * @brief Destroys an index-linked list, deallocating its storage and resetting it to empty.
+ * @param list A pointer to the index-linked list.
+ */
+void ixDestroy(ixlist_t* list);
+
+/**
+ * @brief Appends the elements of an array to the tail of an index-linked list.
+ * @param list A pointer to the index-linked list.
+ * @param arr An integer array containing the data to be added.
+ * @param size An integer representing the size of the array.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int ixFromArray(ixlist_t* list, int arr[], int size);
+
+/**
+ * @brief Copies the elements of an index-linked list into an array.
+ * @param list A pointer to the index-linked list.
+ * @param arr An integer array with room for ixLength(list) elements.
+ * @return The number of elements copied.
+ */
+int ixToArray(ixlist_t* list, int arr[]);
+
+/**
+ * @brief Appends the elements of a linked list to the tail of an index-linked list.
+ * @param list A pointer to the index-linked list.
+ * @param head A pointer to the head node of the linked list.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int ixFromList(ixlist_t* list, node_t* head);
+
+/**
+ * @brief Creates a linked list containing the elements of an index-linked list.
+ * @param list A pointer to the index-linked list.
+ * @return Returns a pointer to the head of created linked list or NULL if empty or error
+ */
+node_t* ixToList(ixlist_t* list);
+
+/**
+ * @brief Saves an index-linked list to a file, one value per line as savetoFile() does.
+ * @param list A pointer to the index-linked list.
+ * @param filename The name of the file to write.
+ * @return Returns 0 upon successful completion. 1 if the file cannot be written.
+ */
+int ixSave(ixlist_t* list, char* filename);
+
+/**
+ * @brief Appends the values stored in a file, such as one written by ixSave() or savetoFile().
+ * Tokens that are not valid ints are skipped, as in createfromStream().
+ * @param list A pointer to the index-linked list.
+ * @param filename The name of the file to read.
+ * @return Returns 0 upon successful completion. 1 if the file cannot be read or memory
+ * allocation fails; values read before the error are kept.
+ */
+int ixLoad(ixlist_t* list, char* filename);
+
+#endif /* IXLIST_H */
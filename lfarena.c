@@ -0,0 +1,97 @@
+/**
+ * Index-addressed node arena shared by the lock-free containers
+ * @file lfarena.c
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include "lfarena.h"
+
+#define LFA_LIMIT ((uint32_t)LFA_BASE * ((1u << LFA_SLABS) - 1))    // Indices available
+
+// Finds the slab holding an index and the index's offset within it.
+static int slabOf(uint32_t index, uint32_t* offset) {
+    uint32_t q = index / LFA_BASE + 1;      // Slab k starts at LFA_BASE * (2^k - 1)
+    int k = 31 - __builtin_clz(q);
+    *offset = index - LFA_BASE * ((1u << k) - 1);
+    return k;
+}
+
+// Initialises an empty arena.
+void lfaInit(lfarena_t* arena) {
+    for (int k = 0; k < LFA_SLABS; k++) {
+        atomic_init(&arena->slabs[k], NULL);
+    }
+    atomic_init(&arena->fresh, 0);
+    atomic_init(&arena->free_head, lfPack(LFA_NIL, 0));
+}
+
+// Returns the node stored at an index.
+lfnode_t* lfaNode(lfarena_t* arena, uint32_t index) {
+    uint32_t offset;
+    int k = slabOf(index, &offset);
+    return &atomic_load_explicit(&arena->slabs[k], memory_order_acquire)[offset];
+}
+
+// Allocates a node, reusing recycled nodes first.
+uint32_t lfaAlloc(lfarena_t* arena) {
+    // Pop from the free list; the tag makes a concurrent pop/push of the same node fail the CAS
+    uint64_t old = atomic_load_explicit(&arena->free_head, memory_order_acquire);
+    while (lfIndex(old) != LFA_NIL) {
+        lfnode_t* node = lfaNode(arena, lfIndex(old));
+        uint64_t next = atomic_load_explicit(&node->next, memory_order_relaxed);
+        uint64_t desired = lfPack(lfIndex(next), lfTag(old) + 1);
+        if (atomic_compare_exchange_weak_explicit(&arena->free_head, &old, desired,
+                                                  memory_order_acquire, memory_order_acquire)) {
+            return lfIndex(old);
+        }
+    }
+
+    // Otherwise claim a never-used index
+    uint32_t index = atomic_load_explicit(&arena->fresh, memory_order_relaxed);
+    do {
+        if (index >= LFA_LIMIT) {
+            fprintf(stderr, "Error: Lock-free arena exhausted\n");
+            return LFA_NIL;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&arena->fresh, &index, index + 1,
+                                                    memory_order_relaxed, memory_order_relaxed));
+
+    // Allocate its slab on first use; the loser of a race frees its copy
+    uint32_t offset;
+    int k = slabOf(index, &offset);
+    if (atomic_load_explicit(&arena->slabs[k], memory_order_acquire) == NULL) {
+        lfnode_t* slab = calloc((size_t)LFA_BASE << k, sizeof(lfnode_t));
+        if (slab == NULL) {
+            fprintf(stderr, "Error: Memory allocation failed in lfaAlloc\n");
+            return LFA_NIL;         // The claimed index is leaked, which is harmless
+        }
+        lfnode_t* expected = NULL;
+        if (!atomic_compare_exchange_strong_explicit(&arena->slabs[k], &expected, slab,
+                                                     memory_order_acq_rel, memory_order_acquire)) {
+            free(slab);
+        }
+    }
+    return index;
+}
+
+// Recycles a node onto the free list.
+void lfaFree(lfarena_t* arena, uint32_t index) {
+    lfnode_t* node = lfaNode(arena, index);
+    // Keep bumping the node's own next tag so stale readers of it never match
+    uint32_t tag = lfTag(atomic_load_explicit(&node->next, memory_order_relaxed)) + 1;
+    uint64_t old = atomic_load_explicit(&arena->free_head, memory_order_relaxed);
+    do {
+        atomic_store_explicit(&node->next, lfPack(lfIndex(old), tag), memory_order_relaxed);
+    } while (!atomic_compare_exchange_weak_explicit(&arena->free_head, &old,
+                                                    lfPack(index, lfTag(old) + 1),
+                                                    memory_order_release, memory_order_relaxed));
+}
+
+// Releases every slab of the arena.
+void lfaRelease(lfarena_t* arena) {
+    for (int k = 0; k < LFA_SLABS; k++) {
+        free(atomic_load_explicit(&arena->slabs[k], memory_order_relaxed));
+    }
+    lfaInit(arena);
+}
@@ -0,0 +1,93 @@
+/**
+ * Index-addressed node arena shared by the lock-free containers
+ * @file lfarena.h
+ * Nodes are addressed by 32-bit indices so that an index and a 32-bit version
+ * tag fit together in one 64-bit word, which every 64-bit target can
+ * compare-and-swap without locks. Slabs grow geometrically and are never
+ * freed before lfaRelease(), so node memory stays valid for late readers.
+*/
+
+#ifndef LFARENA_H
+#define LFARENA_H
+
+#include <stdint.h>
+#include <stdatomic.h>
+
+#define LFA_NIL UINT32_MAX      /**< Index value representing no node */
+#define LFA_BASE 1024           /**< Number of nodes in the first slab; slab k holds LFA_BASE << k */
+#define LFA_SLABS 22            /**< Enough slabs to cover every index below LFA_NIL */
+
+/**
+ * A struct representing a node in a lock-free container.
+*/
+typedef struct lfnode {
+    _Atomic uint64_t next;  /**< Tagged index of the next node, see lfPack() */
+    _Atomic int data;       /**< Integer data, atomic since stale readers may race with reuse */
+} lfnode_t;
+
+/**
+ * A struct representing a growable arena of lock-free nodes with a free list.
+*/
+typedef struct lfarena {
+    _Atomic(lfnode_t*) slabs[LFA_SLABS];    /**< Lazily allocated slabs */
+    _Atomic uint32_t fresh;                 /**< Next never-used node index */
+    _Atomic uint64_t free_head;             /**< Tagged head of the recycled node stack */
+} lfarena_t;
+
+/**
+ * @brief Packs a node index and a version tag into one CAS-able word.
+ */
+static inline uint64_t lfPack(uint32_t index, uint32_t tag) {
+    return ((uint64_t)tag << 32) | index;
+}
+
+/**
+ * @brief Extracts the node index from a tagged word.
+ */
+static inline uint32_t lfIndex(uint64_t word) {
+    return (uint32_t)word;
+}
+
+/**
+ * @brief Extracts the version tag from a tagged word.
+ */
+static inline uint32_t lfTag(uint64_t word) {
+    return (uint32_t)(word >> 32);
+}
+
+/**
+ * @brief Initialises an empty arena.
+ * @param arena A pointer to the arena.
+ */
+void lfaInit(lfarena_t* arena);
+
+/**
+ * @brief Returns the node stored at an index previously returned by lfaAlloc().
+ * @param arena A pointer to the arena.
+ * @param index A node index other than LFA_NIL.
+ * @return A pointer to the node.
+ */
+lfnode_t* lfaNode(lfarena_t* arena, uint32_t index);
+
+/**
+ * @brief Allocates a node, reusing recycled nodes first. Lock-free.
+ * @param arena A pointer to the arena.
+ * @return The index of the node, or LFA_NIL upon memory allocation failure.
+ */
+uint32_t lfaAlloc(lfarena_t* arena);
+
+/**
+ * @brief Recycles a node that is no longer reachable from its container. Lock-free.
+ * The node's next field is reused as the free list link.
+ * @param arena A pointer to the arena.
+ * @param index The index of the node.
+ */
+void lfaFree(lfarena_t* arena, uint32_t index);
+
+/**
+ * @brief Releases every slab of the arena. No other thread may be using it.
+ * @param arena A pointer to the arena.
+ */
+void lfaRelease(lfarena_t* arena);
+
+#endif /* LFARENA_H */
@@ -0,0 +1,118 @@
+/**
+ * Lock-free multi-producer/multi-consumer FIFO queue (Michael-Scott queue)
+ * @file lfqueue.c
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include "lfqueue.h"
+#include "lfarena.h"
+
+/**
+ * A struct representing a lock-free queue.
+*/
+struct lfqueue {
+    _Atomic uint64_t head;  // Tagged index of the sentinel node
+    _Atomic uint64_t tail;  // Tagged index of the last (or second last) node
+    lfarena_t arena;        // Node storage and free list
+};
+
+// Creates an empty lock-free queue holding only a sentinel node.
+lfqueue_t* lfqCreate(void) {
+    lfqueue_t* queue = malloc(sizeof(lfqueue_t));
+    if (queue == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in lfqCreate\n");
+        return NULL;
+    }
+    lfaInit(&queue->arena);
+    uint32_t sentinel = lfaAlloc(&queue->arena);
+    if (sentinel == LFA_NIL) {
+        free(queue);
+        return NULL;
+    }
+    atomic_store(&lfaNode(&queue->arena, sentinel)->next, lfPack(LFA_NIL, 0));
+    atomic_init(&queue->head, lfPack(sentinel, 0));
+    atomic_init(&queue->tail, lfPack(sentinel, 0));
+    return queue;
+}
+
+// Adds a value to the tail of the queue.
+int lfqEnqueue(lfqueue_t* queue, int data) {
+    uint32_t index = lfaAlloc(&queue->arena);
+    if (index == LFA_NIL) return 1;
+
+    lfnode_t* node = lfaNode(&queue->arena, index);
+    atomic_store_explicit(&node->data, data, memory_order_relaxed);
+    // Terminate the node, advancing its next tag past any stale value
+    uint64_t cur = atomic_load_explicit(&node->next, memory_order_relaxed);
+    atomic_store_explicit(&node->next, lfPack(LFA_NIL, lfTag(cur) + 1), memory_order_relaxed);
+
+    uint64_t tail;
+    while (1) {
+        tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        lfnode_t* last = lfaNode(&queue->arena, lfIndex(tail));
+        uint64_t next = atomic_load_explicit(&last->next, memory_order_acquire);
+        if (tail != atomic_load_explicit(&queue->tail, memory_order_acquire)) continue;
+
+        if (lfIndex(next) == LFA_NIL) {
+            // Tail is the real last node: try to link the new node after it
+            if (atomic_compare_exchange_weak_explicit(&last->next, &next,
+                                                      lfPack(index, lfTag(next) + 1),
+                                                      memory_order_release, memory_order_relaxed)) {
+                break;
+            }
+        }
+        else {
+            // Tail is lagging behind: help swing it forward
+            atomic_compare_exchange_weak_explicit(&queue->tail, &tail,
+                                                  lfPack(lfIndex(next), lfTag(tail) + 1),
+                                                  memory_order_release, memory_order_relaxed);
+        }
+    }
+    // Swing tail to the new node; failure means another thread already helped
+    atomic_compare_exchange_strong_explicit(&queue->tail, &tail, lfPack(index, lfTag(tail) + 1),
+                                            memory_order_release, memory_order_relaxed);
+    return 0;
+}
+
+// Removes the value at the head of the queue.
+int lfqDequeue(lfqueue_t* queue, int* data) {
+    uint64_t head;
+    while (1) {
+        head = atomic_load_explicit(&queue->head, memory_order_acquire);
+        uint64_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        lfnode_t* sentinel = lfaNode(&queue->arena, lfIndex(head));
+        uint64_t next = atomic_load_explicit(&sentinel->next, memory_order_acquire);
+        if (head != atomic_load_explicit(&queue->head, memory_order_acquire)) continue;
+
+        if (lfIndex(head) == lfIndex(tail)) {
+            if (lfIndex(next) == LFA_NIL) return 1;     // Empty queue
+            // Tail is lagging behind: help swing it forward
+            atomic_compare_exchange_weak_explicit(&queue->tail, &tail,
+                                                  lfPack(lfIndex(next), lfTag(tail) + 1),
+                                                  memory_order_release, memory_order_relaxed);
+        }
+        else {
+            // Read the value before the CAS, since the node may be recycled right after it.
+            // The first node becomes the new sentinel.
+            int value = atomic_load_explicit(&lfaNode(&queue->arena, lfIndex(next))->data,
+                                             memory_order_relaxed);
+            if (atomic_compare_exchange_weak_explicit(&queue->head, &head,
+                                                      lfPack(lfIndex(next), lfTag(head) + 1),
+                                                      memory_order_acquire, memory_order_relaxed)) {
+                *data = value;
+                break;
+            }
+        }
+    }
+    lfaFree(&queue->arena, lfIndex(head));      // Recycle the old sentinel
+    return 0;
+}
+
+// Destroys a queue, releasing all of its memory.
+void lfqDestroy(lfqueue_t** queue) {
+    if (*queue == NULL) return;
+    lfaRelease(&(*queue)->arena);
+    free(*queue);
+    *queue = NULL;
+}
@@ -0,0 +1,48 @@
+/**
+ * Lock-free multi-producer/multi-consumer FIFO queue (Michael-Scott queue)
+ * @file lfqueue.h
+ * A thread-safe counterpart to enqueue() and pop() on a node_t list, with O(1)
+ * enqueue and dequeue. The queue always holds a sentinel node; head and tail,
+ * and every node's next link, are tagged indices updated by 64-bit CAS.
+ * Dequeued nodes are recycled through the same bounded arena as lfstack.h,
+ * so memory use is bounded by the largest number of items ever queued at once.
+*/
+
+#ifndef LFQUEUE_H
+#define LFQUEUE_H
+
+/**
+ * An opaque type representing a lock-free queue of ints.
+*/
+typedef struct lfqueue lfqueue_t;
+
+/**
+ * @brief Creates an empty lock-free queue.
+ * @return A pointer to the created queue, or NULL upon memory allocation failure.
+ */
+lfqueue_t* lfqCreate(void);
+
+/**
+ * @brief Adds a value to the tail of the queue. Safe to call from any number of threads.
+ * @param queue A pointer to the queue.
+ * @param data An integer data to be added.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int lfqEnqueue(lfqueue_t* queue, int data);
+
+/**
+ * @brief Removes the value at the head of the queue. Safe to call from any number of threads.
+ * @param queue A pointer to the queue.
+ * @param data A pointer to where the removed value is stored.
+ * @return 0 upon successful completion, 1 if the queue is empty.
+ */
+int lfqDequeue(lfqueue_t* queue, int* data);
+
+/**
+ * @brief Destroys a queue, releasing all of its memory.
+ * Must only be called once no other thread is using the queue.
+ * @param queue A pointer to the queue. Passed by reference (e.g. &queue).
+ */
+void lfqDestroy(lfqueue_t** queue);
+
+#endif /* LFQUEUE_H */
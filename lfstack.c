@@ -0,0 +1,77 @@
+/**
+ * Lock-free concurrent stack (Treiber stack)
+ * @file lfstack.c
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include "lfstack.h"
+#include "lfarena.h"
+
+/**
+ * A struct representing a lock-free stack.
+*/
+struct lfstack {
+    _Atomic uint64_t head;  // Tagged index of the top node
+    lfarena_t arena;        // Node storage and free list
+};
+
+// Creates an empty lock-free stack.
+lfstack_t* lfsCreate(void) {
+    lfstack_t* stack = malloc(sizeof(lfstack_t));
+    if (stack == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in lfsCreate\n");
+        return NULL;
+    }
+    atomic_init(&stack->head, lfPack(LFA_NIL, 0));
+    lfaInit(&stack->arena);
+    return stack;
+}
+
+// Pushes a value onto the stack.
+int lfsPush(lfstack_t* stack, int data) {
+    uint32_t index = lfaAlloc(&stack->arena);
+    if (index == LFA_NIL) return 1;
+
+    lfnode_t* node = lfaNode(&stack->arena, index);
+    atomic_store_explicit(&node->data, data, memory_order_relaxed);
+    uint64_t old = atomic_load_explicit(&stack->head, memory_order_relaxed);
+    do {
+        // Link to the current top, then swing head to the new node
+        atomic_store_explicit(&node->next, lfPack(lfIndex(old), 0), memory_order_relaxed);
+    } while (!atomic_compare_exchange_weak_explicit(&stack->head, &old,
+                                                    lfPack(index, lfTag(old) + 1),
+                                                    memory_order_release, memory_order_relaxed));
+    return 0;
+}
+
+// Pops the most recently pushed value.
+int lfsPop(lfstack_t* stack, int* data) {
+    uint64_t old = atomic_load_explicit(&stack->head, memory_order_acquire);
+    lfnode_t* node;
+
+    do {
+        if (lfIndex(old) == LFA_NIL) return 1;
+        // The node may be popped and reused concurrently; its memory stays valid
+        // and the tag on head makes the CAS below fail if that happened.
+        node = lfaNode(&stack->arena, lfIndex(old));
+        uint64_t next = atomic_load_explicit(&node->next, memory_order_relaxed);
+        if (atomic_compare_exchange_weak_explicit(&stack->head, &old,
+                                                  lfPack(lfIndex(next), lfTag(old) + 1),
+                                                  memory_order_acquire, memory_order_acquire)) {
+            break;
+        }
+    } while (1);
+
+    *data = atomic_load_explicit(&node->data, memory_order_relaxed);
+    lfaFree(&stack->arena, lfIndex(old));
+    return 0;
+}
+
+// Destroys a stack, releasing all of its memory.
+void lfsDestroy(lfstack_t** stack) {
+    if (*stack == NULL) return;
+    lfaRelease(&(*stack)->arena);
+    free(*stack);
+    *stack = NULL;
+}
@@ -0,0 +1,49 @@
+/**
+ * Lock-free concurrent stack (Treiber stack)
+ * @file lfstack.h
+ * A thread-safe counterpart to push() and pop() on a node_t list. The head is
+ * updated with a single 64-bit compare-and-swap that packs a 32-bit node index
+ * with a 32-bit version tag, which protects against the ABA problem.
+ * Popped nodes are recycled through an internal lock-free free list and their
+ * memory is only returned to the system by lfsDestroy(), so a thread that reads
+ * a node after another thread popped it never touches freed memory.
+*/
+
+#ifndef LFSTACK_H
+#define LFSTACK_H
+
+/**
+ * An opaque type representing a lock-free stack of ints.
+*/
+typedef struct lfstack lfstack_t;
+
+/**
+ * @brief Creates an empty lock-free stack.
+ * @return A pointer to the created stack, or NULL upon memory allocation failure.
+ */
+lfstack_t* lfsCreate(void);
+
+/**
+ * @brief Pushes a value onto the stack. Safe to call from any number of threads.
+ * @param stack A pointer to the stack.
+ * @param data An integer data to be pushed.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int lfsPush(lfstack_t* stack, int data);
+
+/**
+ * @brief Pops the most recently pushed value. Safe to call from any number of threads.
+ * @param stack A pointer to the stack.
+ * @param data A pointer to where the popped value is stored.
+ * @return 0 upon successful completion, 1 if the stack is empty.
+ */
+int lfsPop(lfstack_t* stack, int* data);
+
+/**
+ * @brief Destroys a stack, releasing all of its memory.
+ * Must only be called once no other thread is using the stack.
+ * @param stack A pointer to the stack. Passed by reference (e.g. &stack).
+ */
+void lfsDestroy(lfstack_t** stack);
+
+#endif /* LFSTACK_H */
@@ -0,0 +1,441 @@
+/**
+ * Multi-threaded operations on singly linked lists
+ * @file parallel.c
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <limits.h>
+#include <unistd.h>
+#include "parallel.h"
+#include "rng.h"
+
+#define CHUNK 1024      // Distance between recorded nodes when splitting a list
+
+/**
+ * A struct describing one unit of work for a worker thread.
+*/
+typedef struct task {
+    node_t* left;       // Segment to sort, or left run to merge
+    node_t* right;      // Right run to merge, NULL when sorting
+    node_t* result;     // Head of the sorted or merged list
+} task_t;
+
+// Resolves a requested thread count, defaulting to the number of online CPUs.
+// Capped at PARALLEL_MAX_THREADS, since callers also size stack arrays by it.
+static int threadCount(int threads) {
+    if (threads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cpus <= 0 ? 1 : cpus < PARALLEL_MAX_THREADS ? (int)cpus : PARALLEL_MAX_THREADS;
+    }
+    return threads < PARALLEL_MAX_THREADS ? threads : PARALLEL_MAX_THREADS;
+}
+
+// Sorts one segment, or merges two sorted runs.
+static void* runTask(void* arg) {
+    task_t* task = arg;
+    if (task->right == NULL) {
+        task->result = task->left;
+        naturalMergeSort(&task->result);
+    }
+    else {
+        merge(&task->result, task->left, task->right);  // Left first keeps it stable
+    }
+    return NULL;
+}
+
+/**
+ * A struct representing the worker threads of one parallelSort() call. Each
+ * round of tasks is posted as a queue the workers claim from; the poster
+ * claims tasks too and waits until all of them are done, acting as a barrier.
+*/
+typedef struct pool {
+    pthread_mutex_t lock;
+    pthread_cond_t posted;      // Signalled when a round is posted or the pool stops
+    pthread_cond_t finished;    // Signalled when the last task of a round is done
+    task_t* tasks;              // Tasks of the current round
+    int count;                  // Number of tasks in the current round
+    int next;                   // Next task to claim
+    int pending;                // Tasks claimed or waiting, not yet done
+    int stop;                   // Set to make the workers exit
+    pthread_t* tids;
+    int workers;                // Threads started, not counting the caller
+} pool_t;
+
+// Claims and runs tasks of the current round until none are left. Called with the lock held.
+static void drainTasks(pool_t* pool) {
+    while (pool->next < pool->count) {
+        task_t* task = &pool->tasks[pool->next++];
+        pthread_mutex_unlock(&pool->lock);
+        runTask(task);
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0) pthread_cond_signal(&pool->finished);
+    }
+}
+
+// Worker thread: runs tasks of every posted round until the pool stops.
+static void* runWorker(void* arg) {
+    pool_t* pool = arg;
+    pthread_mutex_lock(&pool->lock);
+    while (!pool->stop) {
+        if (pool->next < pool->count) drainTasks(pool);
+        else pthread_cond_wait(&pool->posted, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+// Starts up to threads - 1 workers; the calling thread is the last one.
+// Returns 0, or 1 if the pool could not be set up at all.
+static int startPool(pool_t* pool, int threads) {
+    pool->tasks = NULL;
+    pool->count = pool->next = pool->pending = pool->stop = 0;
+    pool->workers = 0;
+    pool->tids = malloc(sizeof(pthread_t) * threads);
+    if (pool->tids == NULL) return 1;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->posted, NULL);
+    pthread_cond_init(&pool->finished, NULL);
+    // A worker that fails to start just leaves more tasks for the others
+    for (int i = 1; i < threads; i++) {
+        if (pthread_create(&pool->tids[pool->workers], NULL, runWorker, pool) == 0) pool->workers++;
+    }
+    return 0;
+}
+
+// Runs one round of tasks on the pool and returns once every task is done.
+static void runTasks(pool_t* pool, task_t tasks[], int count) {
+    pthread_mutex_lock(&pool->lock);
+    pool->tasks = tasks;
+    pool->count = count;
+    pool->next = 0;
+    pool->pending = count;
+    pthread_cond_broadcast(&pool->posted);
+    drainTasks(pool);
+    while (pool->pending > 0) pthread_cond_wait(&pool->finished, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// Stops the workers and releases the pool.
+static void stopPool(pool_t* pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->posted);
+    pthread_mutex_unlock(&pool->lock);
+    for (int i = 0; i < pool->workers; i++) pthread_join(pool->tids[i], NULL);
+    pthread_cond_destroy(&pool->finished);
+    pthread_cond_destroy(&pool->posted);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->tids);
+}
+
+// Sorts a linked list in ascending order using several threads.
+void parallelSort(node_t** head, int threads) {
+    if (!*head || !(*head)->next) return;
+    threads = threadCount(threads);
+
+    // Single pass: record the last node of every CHUNK-sized block
+    int chunks = 0, capacity = 64;
+    node_t** ends = malloc(sizeof(node_t*) * capacity);
+    int n = 0;
+    for (node_t* ptr = *head; ptr != NULL && ends != NULL; ptr = ptr->next) {
+        if (++n % CHUNK == 0) {
+            if (chunks == capacity) {
+                capacity *= 2;
+                node_t** grown = realloc(ends, sizeof(node_t*) * capacity);
+                if (grown == NULL) {
+                    free(ends);
+                    ends = NULL;
+                    break;
+                }
+                ends = grown;
+            }
+            ends[chunks++] = ptr;
+        }
+    }
+
+    // One thread per segment at most, and a segment is at least one chunk
+    if (threads > chunks) threads = chunks;
+    // Fall back to the serial sort for short lists, one thread or allocation failure
+    if (ends == NULL || n < PARALLEL_SORT_THRESHOLD || threads < 2) {
+        free(ends);
+        naturalMergeSort(head);
+        return;
+    }
+
+    // The workers are started once and serve the sort and every merge round
+    pool_t pool;
+    if (startPool(&pool, threads)) {
+        free(ends);
+        naturalMergeSort(head);
+        return;
+    }
+
+    // Cut into contiguous segments of whole chunks; the last one takes the remainder
+    task_t tasks[threads];
+    node_t* start = *head;
+    for (int i = 0; i < threads; i++) {
+        tasks[i] = (task_t){ start, NULL, NULL };
+        if (i < threads - 1) {
+            node_t* end = ends[(long)(i + 1) * chunks / threads - 1];
+            start = end->next;
+            end->next = NULL;
+        }
+    }
+    free(ends);
+
+    runTasks(&pool, tasks, threads);
+
+    // Merge tree: each round merges neighbouring runs in parallel, preserving order
+    int runs = threads;
+    while (runs > 1) {
+        int pairs = runs / 2;
+        for (int i = 0; i < pairs; i++) {
+            tasks[i] = (task_t){ tasks[2 * i].result, tasks[2 * i + 1].result, NULL };
+        }
+        runTasks(&pool, tasks, pairs);
+        if (runs % 2) {             // Carry the odd run out to the next round
+            tasks[pairs].result = tasks[runs - 1].result;
+        }
+        runs = pairs + runs % 2;
+    }
+    stopPool(&pool);
+    *head = tasks[0].result;
+}
+
+/**
+ * A struct describing the blocks of an array one thread fills.
+*/
+typedef struct fill {
+    int* arr;
+    int size;
+    int min, max;
+    unsigned long long seed;
+    int first, last;    // Range of blocks, last exclusive
+} fill_t;
+
+// Fills one thread's blocks, jumping the generator once per block.
+static void* runFill(void* arg) {
+    fill_t* fill = arg;
+    rng_t rng;
+    rngSeed(&rng, fill->seed);
+    for (int k = 0; k < fill->first; k++) rngJump(&rng);
+
+    for (int k = fill->first; k < fill->last; k++) {
+        rng_t block = rng;
+        long start = (long)k * PARALLEL_FILL_BLOCK;
+        int count = fill->size - start < PARALLEL_FILL_BLOCK ? (int)(fill->size - start)
+                                                             : PARALLEL_FILL_BLOCK;
+        rngFill(&block, &fill->arr[start], count, fill->min, fill->max);
+        rngJump(&rng);
+    }
+    return NULL;
+}
+
+// Fills an array with random numbers using several threads.
+void parallelRandomArray(int arr[], int size, int min, int max, unsigned long long seed, int threads) {
+    if (size <= 0) return;
+    int blocks = (int)(((long)size + PARALLEL_FILL_BLOCK - 1) / PARALLEL_FILL_BLOCK);
+    threads = threadCount(threads);
+    if (threads > blocks) threads = blocks;
+
+    fill_t fills[threads];
+    pthread_t tids[threads];
+    int started[threads];
+    for (int i = 0; i < threads; i++) {
+        fills[i] = (fill_t){ arr, size, min, max, seed,
+                             (int)((long)i * blocks / threads), (int)((long)(i + 1) * blocks / threads) };
+    }
+    // The calling thread takes the first share
+    for (int i = 1; i < threads; i++) {
+        started[i] = pthread_create(&tids[i], NULL, runFill, &fills[i]) == 0;
+        if (!started[i]) runFill(&fills[i]);
+    }
+    runFill(&fills[0]);
+    for (int i = 1; i < threads; i++) {
+        if (started[i]) pthread_join(tids[i], NULL);
+    }
+}
+
+// Builds a segment index over a linked list in one pass.
+int buildSegments(segindex_t* index, node_t* head, int stride) {
+    if (stride <= 0) stride = PARALLEL_SEGMENT;
+    int capacity = 64;
+    index->starts = malloc(sizeof(node_t*) * capacity);
+    index->segments = 0;
+    index->length = 0;
+    for (node_t* ptr = head; ptr != NULL && index->starts != NULL; ptr = ptr->next) {
+        if (index->length++ % stride) continue;
+        if (index->segments == capacity) {
+            capacity *= 2;
+            node_t** grown = realloc(index->starts, sizeof(node_t*) * capacity);
+            if (grown == NULL) {
+                free(index->starts);
+                index->starts = NULL;
+                break;
+            }
+            index->starts = grown;
+        }
+        index->starts[index->segments++] = ptr;
+    }
+    if (index->starts == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in buildSegments\n");
+        index->segments = 0;
+        index->length = 0;
+        return 1;
+    }
+    return 0;
+}
+
+// Frees the memory of a segment index.
+void destroySegments(segindex_t* index) {
+    free(index->starts);
+    index->starts = NULL;
+    index->segments = 0;
+    index->length = 0;
+}
+
+/**
+ * Reductions supported by runReduce().
+*/
+typedef enum reduceop { REDUCE_COUNT, REDUCE_LENGTH, REDUCE_SUM, REDUCE_MIN, REDUCE_MAX, REDUCE_FOLD } reduceop_t;
+
+/**
+ * A struct describing one reduction, shared by every worker thread.
+*/
+typedef struct reduce {
+    const segindex_t* index;
+    reduceop_t op;
+    int value;              // Value to count
+    long long init;         // Initial accumulator of a fold
+    fold_t step;
+    void* arg;
+    long long* partials;    // One result per segment
+    _Atomic int next;       // Next segment to claim
+} reduce_t;
+
+// Reduces one segment, which ends where the next one starts.
+static long long reduceSegment(reduce_t* r, int segment) {
+    node_t* ptr = r->index->starts[segment];
+    node_t* end = segment + 1 < r->index->segments ? r->index->starts[segment + 1] : NULL;
+    long long acc;
+    switch (r->op) {
+        case REDUCE_COUNT:
+            for (acc = 0; ptr != end; ptr = ptr->next) acc += ptr->data == r->value;
+            break;
+        case REDUCE_LENGTH:
+            for (acc = 0; ptr != end; ptr = ptr->next) acc++;
+            break;
+        case REDUCE_SUM:
+            for (acc = 0; ptr != end; ptr = ptr->next) acc += ptr->data;
+            break;
+        case REDUCE_MIN:
+            for (acc = INT_MAX; ptr != end; ptr = ptr->next) if (ptr->data < acc) acc = ptr->data;
+            break;
+        case REDUCE_MAX:
+            for (acc = INT_MIN; ptr != end; ptr = ptr->next) if (ptr->data > acc) acc = ptr->data;
+            break;
+        default:
+            for (acc = r->init; ptr != end; ptr = ptr->next) acc = r->step(acc, ptr->data, r->arg);
+            break;
+    }
+    return acc;
+}
+
+// Claims and reduces segments until none are left, so uneven segments balance out.
+static void* runReduce(void* arg) {
+    reduce_t* r = arg;
+    int segment;
+    while ((segment = atomic_fetch_add_explicit(&r->next, 1, memory_order_relaxed)) < r->index->segments) {
+        r->partials[segment] = reduceSegment(r, segment);
+    }
+    return NULL;
+}
+
+// Runs a reduction on several threads, leaving one partial result per segment.
+static int runReduction(reduce_t* r, int threads) {
+    r->partials = malloc(sizeof(long long) * (r->index->segments ? r->index->segments : 1));
+    if (r->partials == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in parallel reduction\n");
+        return 1;
+    }
+    atomic_init(&r->next, 0);
+    threads = threadCount(threads);
+    if (threads > r->index->segments) threads = r->index->segments;
+
+    pthread_t tids[threads > 0 ? threads : 1];
+    int started[threads > 0 ? threads : 1];
+    for (int i = 1; i < threads; i++) {
+        started[i] = pthread_create(&tids[i], NULL, runReduce, r) == 0;
+    }
+    runReduce(r);                   // The calling thread claims segments too
+    for (int i = 1; i < threads; i++) {
+        if (started[i]) pthread_join(tids[i], NULL);
+    }
+    return 0;
+}
+
+// Merges the partial result of one segment into the result of a built-in reduction.
+static long long combineBuiltin(reduceop_t op, long long acc, long long partial) {
+    if (op == REDUCE_MIN) return partial < acc ? partial : acc;
+    if (op == REDUCE_MAX) return partial > acc ? partial : acc;
+    return acc + partial;
+}
+
+// Runs one of the built-in reductions and combines the partial results.
+static long long reduceBuiltin(const segindex_t* index, reduceop_t op, int value, int threads) {
+    reduce_t r = { .index = index, .op = op, .value = value };
+    long long result = op == REDUCE_MIN ? INT_MAX : op == REDUCE_MAX ? INT_MIN : 0;
+    int serial = runReduction(&r, threads);     // On allocation failure, walk the segments here
+    for (int i = 0; i < index->segments; i++) {
+        result = combineBuiltin(op, result, serial ? reduceSegment(&r, i) : r.partials[i]);
+    }
+    if (!serial) free(r.partials);
+    return result;
+}
+
+// Counts the number of occurences of a given value using several threads.
+int parallelCount(const segindex_t* index, int value, int threads) {
+    return (int)reduceBuiltin(index, REDUCE_COUNT, value, threads);
+}
+
+// Counts the nodes of a list using several threads.
+int parallelLength(const segindex_t* index, int threads) {
+    return (int)reduceBuiltin(index, REDUCE_LENGTH, 0, threads);
+}
+
+// Sums the values of a list using several threads.
+long long parallelSum(const segindex_t* index, int threads) {
+    return reduceBuiltin(index, REDUCE_SUM, 0, threads);
+}
+
+// Finds the smallest value of a list using several threads.
+int parallelMin(const segindex_t* index, int* min, int threads) {
+    if (index->segments == 0) return 1;
+    *min = (int)reduceBuiltin(index, REDUCE_MIN, 0, threads);
+    return 0;
+}
+
+// Finds the largest value of a list using several threads.
+int parallelMax(const segindex_t* index, int* max, int threads) {
+    if (index->segments == 0) return 1;
+    *max = (int)reduceBuiltin(index, REDUCE_MAX, 0, threads);
+    return 0;
+}
+
+// Reduces a list with a user-supplied fold using several threads.
+long long parallelFold(const segindex_t* index, long long init, fold_t step, fold_t combine,
+                       void* arg, int threads) {
+    reduce_t r = { .index = index, .op = REDUCE_FOLD, .init = init, .step = step, .arg = arg };
+    int serial = runReduction(&r, threads);     // On allocation failure, walk the segments here
+    long long result = init;
+    for (int i = 0; i < index->segments; i++) {
+        result = combine(result, serial ? reduceSegment(&r, i) : r.partials[i], arg);
+    }
+    if (!serial) free(r.partials);
+    return result;
+}
@@ -0,0 +1,156 @@
+/**
+ * Multi-threaded operations on singly linked lists
+ * @file parallel.h
+*/
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include "sllist.h"
+
+/**
+ * Upper bound on the threads any call here starts, whatever count is requested.
+*/
+#ifndef PARALLEL_MAX_THREADS
+#define PARALLEL_MAX_THREADS 256
+#endif
+
+/**
+ * Lists shorter than this many nodes are sorted on the calling thread.
+*/
+#ifndef PARALLEL_SORT_THRESHOLD
+#define PARALLEL_SORT_THRESHOLD 65536
+#endif
+
+/**
+ * Number of elements filled from each random stream by parallelRandomArray().
+*/
+#define PARALLEL_FILL_BLOCK 65536
+
+/**
+ * @brief Sorts a linked list in ascending order using several threads.
+ * One pass over the list records a node every 1024 positions, which is used to cut
+ * the list into one contiguous segment per thread. The segments are sorted concurrently
+ * and then combined pairwise, with each round of the merge tree running in parallel.
+ * The worker threads are started once per call and reused for every round.
+ * The result is stable and identical to mergeSort(). Short lists, or a thread count
+ * of 1, use the serial sort. No more threads are started than there are 1024-node blocks
+ * or PARALLEL_MAX_THREADS.
+ * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
+ * @param threads The number of threads to use, or 0 or less for the number of online CPUs.
+ * @return Returns nothing.
+*/
+void parallelSort(node_t** head, int threads);
+
+/**
+ * @brief Fill an array of integers with random numbers ranging from min to max using several threads.
+ * The array is cut into blocks of PARALLEL_FILL_BLOCK elements and block k is filled from the
+ * seeded generator jumped k times (see rngJump()), so the result depends only on the seed,
+ * never on the thread count.
+ * @param arr The array to be filled with random numbers.
+ * @param size The size of the array.
+ * @param min The minimum value of the random numbers.
+ * @param max The maximum value of the random numbers.
+ * @param seed The seed; equal seeds produce equal arrays.
+ * @param threads The number of threads to use, or 0 or less for the number of online CPUs.
+ * @return Returns nothing.
+*/
+void parallelRandomArray(int arr[], int size, int min, int max, unsigned long long seed, int threads);
+
+/**
+ * Default number of nodes per segment of a segindex_t.
+*/
+#define PARALLEL_SEGMENT 4096
+
+/**
+ * A struct holding every k-th node of a list, cutting it into segments that
+ * threads can walk independently. Valid until the list is modified.
+*/
+typedef struct segindex {
+    node_t** starts;    /**< First node of each segment */
+    int segments;       /**< Number of segments */
+    int length;         /**< Number of nodes when the index was built */
+} segindex_t;
+
+/**
+ * A user-supplied fold step: combines an accumulator with one value, or with another accumulator.
+*/
+typedef long long (*fold_t)(long long acc, long long value, void* arg);
+
+/**
+ * @brief Builds a segment index over a linked list in one pass.
+ * The index can be reused by any number of reductions while the list is unchanged.
+ * @param index A pointer to the index to fill.
+ * @param head A pointer to the head node of the linked list.
+ * @param stride The number of nodes per segment, or 0 or less for PARALLEL_SEGMENT.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+*/
+int buildSegments(segindex_t* index, node_t* head, int stride);
+
+/**
+ * @brief Frees the memory of a segment index, leaving the list intact.
+ * @param index A pointer to the index.
+ * @return Returns nothing.
+*/
+void destroySegments(segindex_t* index);
+
+/**
+ * @brief Counts the number of occurences of a given value using several threads.
+ * @param index A pointer to a segment index over the list.
+ * @param value The value to search for in the list.
+ * @param threads The number of threads to use, or 0 or less for the number of online CPUs.
+ * @return The number of occurences.
+*/
+int parallelCount(const segindex_t* index, int value, int threads);
+
+/**
+ * @brief Counts the nodes of a list using several threads.
+ * @param index A pointer to a segment index over the list.
+ * @param threads The number of threads to use, or 0 or less for the number of online CPUs.
+ * @return The number of nodes.
+*/
+int parallelLength(const segindex_t* index, int threads);
+
+/**
+ * @brief Sums the values of a list using several threads.
+ * @param index A pointer to a segment index over the list.
+ * @param threads The number of threads to use, or 0 or less for the number of online CPUs.
+ * @return The sum of all values.
+*/
+long long parallelSum(const segindex_t* index, int threads);
+
+/**
+ * @brief Finds the smallest value of a list using several threads.
+ * @param index A pointer to a segment index over the list.
+ * @param min A pointer to where the smallest value is stored.
+ * @param threads The number of threads to use, or 0 or less for the number of online CPUs.
+ * @return 0 upon successful completion, 1 if the list is empty.
+*/
+int parallelMin(const segindex_t* index, int* min, int threads);
+
+/**
+ * @brief Finds the largest value of a list using several threads.
+ * @param index A pointer to a segment index over the list.
+ * @param max A pointer to where the largest value is stored.
+ * @param threads The number of threads to use, or 0 or less for the number of online CPUs.
+ * @return 0 upon successful completion, 1 if the list is empty.
+*/
+int parallelMax(const segindex_t* index, int* max, int threads);
+
+/**
+ * @brief Reduces a list with a user-supplied fold using several threads.
+ * Each segment is folded from init with step(acc, value, arg), then the partial results
+ * are combined in list order with combine(acc, partial, arg), starting from init.
+ * The result matches a serial fold whenever step and combine agree and combine is associative.
+ * @param index A pointer to a segment index over the list.
+ * @param init The initial accumulator, e.g. 0 for a sum.
+ * @param step The function folding one value into an accumulator.
+ * @param combine The function merging two accumulators.
+ * @param arg A pointer passed through to step and combine.
+ * @param threads The number of threads to use, or 0 or less for the number of online CPUs.
+ * @return The combined result, or init for an empty list.
+*/
+long long parallelFold(const segindex_t* index, long long init, fold_t step, fold_t combine,
+                       void* arg, int threads);
+
+#endif /* PARALLEL_H */
@@ -0,0 +1,177 @@
+/**
+ * Persistent singly linked lists with structural sharing
+ * @file plist.c
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdatomic.h>
+#include "plist.h"
+#include "stats.h"
+
+#ifdef SLLIST_STATS
+// Route allocations through the counting wrappers in stats.c
+#define malloc(size) statMalloc(size)
+#define free(ptr) statFree(ptr)
+#endif
+
+// A root word packs a 48-bit version pointer with a 16-bit count of
+// snapshots that have claimed the pointer but not yet taken their reference.
+#define PTR_BITS 48
+#define PTR_MASK ((1ULL << PTR_BITS) - 1)
+#define ONE_CLAIM (1ULL << PTR_BITS)
+
+/**
+ * A struct representing a node shared by every version that contains it.
+*/
+struct plist {
+    _Atomic int refs;       // Versions and nodes referring to this node
+    int data;
+    plist_t* next;          // Owns one reference to the next node
+};
+
+// Unpacks the version pointer of a root word.
+static inline plist_t* rootList(uint64_t word) {
+    return (plist_t*)(uintptr_t)(word & PTR_MASK);
+}
+
+// Creates a version with data added to the head of list.
+plist_t* plPush(plist_t* list, int data) {
+    plist_t* node = malloc(sizeof(plist_t));
+    if (node == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in plPush\n");
+        return NULL;
+    }
+    atomic_init(&node->refs, 1);
+    node->data = data;
+    node->next = plRetain(list);
+    return node;
+}
+
+// Returns the version without the head of list.
+plist_t* plPop(plist_t* list) {
+    if (list == NULL) {
+        fprintf(stderr, "Error: Cannot pop empty list.\n");
+        return NULL;
+    }
+    return plRetain(list->next);
+}
+
+// Takes another reference to a version.
+plist_t* plRetain(plist_t* list) {
+    if (list != NULL) atomic_fetch_add_explicit(&list->refs, 1, memory_order_relaxed);
+    return list;
+}
+
+// Drops a reference to a version, freeing the nodes no other version shares.
+void plRelease(plist_t** list) {
+    plist_t* node = *list;
+    *list = NULL;
+    // Freeing a node drops its reference to the next one, so walk until a shared node
+    // acq_rel: the last release must see every other holder's reads of the node
+    while (node != NULL && atomic_fetch_sub_explicit(&node->refs, 1, memory_order_acq_rel) == 1) {
+        plist_t* next = node->next;
+        free(node);
+        node = next;
+    }
+}
+
+// Reads the value at the head of a version.
+int plHead(plist_t* list, int* data) {
+    if (list == NULL) return 1;
+    *data = list->data;
+    return 0;
+}
+
+// Returns the tail of a version without taking a reference.
+plist_t* plNext(plist_t* list) {
+    return list != NULL ? list->next : NULL;
+}
+
+// Counts the number of elements in a version.
+int plLength(plist_t* list) {
+    int i = 0;
+    for (; list != NULL; list = list->next) i++;
+    return i;
+}
+
+// Counts the number of occurences of a given value in a version.
+int plCount(plist_t* list, int value) {
+    int i = 0;
+    for (; list != NULL; list = list->next) i += list->data == value;
+    return i;
+}
+
+// Creates a version from an array, keeping the array's order.
+plist_t* plFromArray(int arr[], int size) {
+    plist_t* list = NULL;
+    for (int i = size - 1; i >= 0; i--) {
+        plist_t* next = plPush(list, arr[i]);
+        plRelease(&list);           // The new head holds the only reference now
+        if (next == NULL) return NULL;
+        list = next;
+    }
+    return list;
+}
+
+// Creates a mutable linked list containing the elements of a version.
+node_t* plToList(plist_t* list) {
+    sllist_t out;
+    initList(&out);
+    for (; list != NULL; list = list->next) {
+        if (listEnqueue(&out, list->data)) {
+            listDestroy(&out);
+            return NULL;
+        }
+    }
+    return out.head;
+}
+
+// Initialises a shared slot to hold the empty list.
+void plRootInit(plroot_t* root) {
+    atomic_init(&root->word, 0);
+}
+
+// Makes a version the current one.
+void plPublish(plroot_t* root, plist_t* list) {
+    plRetain(list);
+    uint64_t old = atomic_exchange(&root->word, (uint64_t)(uintptr_t)list);
+    plist_t* previous = rootList(old);
+    if (previous == NULL) return;
+
+    // Snapshots still holding a claim on the old pointer now count against the node;
+    // each of them drops one reference once it sees the pointer was replaced
+    int claims = (int)(old >> PTR_BITS);
+    if (claims) atomic_fetch_add(&previous->refs, claims);
+    plRelease(&previous);
+}
+
+// Takes a reference to the current version.
+plist_t* plSnapshot(plroot_t* root) {
+    // Claiming keeps the node alive: it is either still published or its
+    // claims have been moved into its reference count
+    uint64_t old = atomic_fetch_add(&root->word, ONE_CLAIM);
+    plist_t* list = rootList(old);
+    if (list != NULL) atomic_fetch_add(&list->refs, 1);
+
+    // Return the claim while the pointer is still published; claims are
+    // interchangeable, so any outstanding one will do
+    uint64_t cur = atomic_load(&root->word);
+    while (rootList(cur) == list && (cur >> PTR_BITS) != 0) {
+        if (atomic_compare_exchange_weak(&root->word, &cur, cur - ONE_CLAIM)) return list;
+    }
+    // Our claim was moved into the reference count; drop it
+    if (list != NULL) atomic_fetch_sub(&list->refs, 1);
+    return list;
+}
+
+// Releases the version held by a shared slot.
+void plRootDestroy(plroot_t* root) {
+    plist_t* list = rootList(atomic_exchange(&root->word, 0));
+    plRelease(&list);
+}
+
+// Returns the number of references to the head node of a version.
+int plRefs(plist_t* list) {
+    return list != NULL ? atomic_load(&list->refs) : 0;
+}
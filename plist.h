@@ -0,0 +1,160 @@
+/**
+ * Persistent singly linked lists with structural sharing
+ * @file plist.h
+ * A plist_t is an immutable version of a list; NULL is the empty list.
+ * plPush() and plPop() return new versions that share their tail with the
+ * version they were made from, so both stay valid. Every version a caller
+ * holds is one reference, dropped with plRelease(). Node reference counts are
+ * atomic, so versions can be read and released on any thread, and a node is
+ * freed when the last version containing it goes away.
+ *
+ * plroot_t is a shared slot for the current version: a writer publishes new
+ * versions with plPublish() while readers on other threads take O(1)
+ * snapshots with plSnapshot(). Neither side takes a lock; the slot uses split
+ * reference counting, so snapshots never touch a node the writer has freed.
+ * The slot packs a pointer into 48 bits, as user-space addresses on x86-64
+ * and AArch64 Linux allow.
+ *
+ * Example:
+ *     plist_t* next = plPush(current, 42);   // Writer
+ *     plRelease(&current);
+ *     current = next;
+ *     plPublish(&root, current);
+ *     plist_t* view = plSnapshot(&root);     // Reader
+ *     ...
+ *     plRelease(&view);
+*/
+
+#ifndef PLIST_H
+#define PLIST_H
+
+#include <stdint.h>
+#include "sllist.h"
+
+/**
+ * An opaque type representing one version of a persistent list.
+*/
+typedef struct plist plist_t;
+
+/**
+ * A struct representing a shared slot holding the current version of a list.
+ * Initialise with plRootInit() and release with plRootDestroy().
+*/
+typedef struct plroot {
+    _Atomic uint64_t word;      /**< Version pointer and count of snapshots in progress */
+} plroot_t;
+
+/**
+ * @brief Creates a version with data added to the head of list.
+ * list is shared, not copied; the caller keeps its own reference to it.
+ * @param list The version to extend, or NULL for the empty list.
+ * @param data An integer data to be pushed.
+ * @return The new version, or NULL upon memory allocation failure.
+ */
+plist_t* plPush(plist_t* list, int data);
+
+/**
+ * @brief Returns the version without the head of list.
+ * The caller keeps its own reference to list and gets a new one to the result.
+ * @param list The version to pop from.
+ * @return The tail of list, or NULL if list has at most one element.
+ */
+plist_t* plPop(plist_t* list);
+
+/**
+ * @brief Takes another reference to a version in O(1).
+ * @param list The version, or NULL.
+ * @return list.
+ */
+plist_t* plRetain(plist_t* list);
+
+/**
+ * @brief Drops a reference to a version, freeing the nodes no other version shares.
+ * @param list A pointer to the version. Passed by reference (e.g. &list); set to NULL.
+ */
+void plRelease(plist_t** list);
+
+/**
+ * @brief Reads the value at the head of a version.
+ * @param list The version.
+ * @param data A pointer to where the value is stored.
+ * @return 0 upon successful completion, 1 if the list is empty.
+ */
+int plHead(plist_t* list, int* data);
+
+/**
+ * @brief Returns the tail of a version without taking a reference, for iteration.
+ * The result stays valid as long as list does.
+ * @param list The version.
+ * @return The tail, or NULL at the end of the list.
+ */
+plist_t* plNext(plist_t* list);
+
+/**
+ * @brief Counts the number of elements in a version.
+ * @param list The version.
+ * @return The number of elements.
+ */
+int plLength(plist_t* list);
+
+/**
+ * @brief Counts the number of occurences of a given value in a version.
+ * @param list The version.
+ * @param value The value to search for in the list.
+ * @return The number of occurences.
+ */
+int plCount(plist_t* list, int value);
+
+/**
+ * @brief Creates a version from an array, keeping the array's order.
+ * @param arr An integer array containing the data to be added.
+ * @param size An integer representing the size of the array.
+ * @return The new version, or NULL if empty or upon memory allocation failure.
+ */
+plist_t* plFromArray(int arr[], int size);
+
+/**
+ * @brief Creates a mutable linked list containing the elements of a version.
+ * @param list The version.
+ * @return Returns a pointer to the head of created linked list or NULL if empty or error
+ */
+node_t* plToList(plist_t* list);
+
+/**
+ * @brief Initialises a shared slot to hold the empty list.
+ * @param root A pointer to the slot.
+ */
+void plRootInit(plroot_t* root);
+
+/**
+ * @brief Makes a version the current one. Safe to call concurrently with plSnapshot().
+ * The slot takes its own reference; the caller keeps its reference to list.
+ * @param root A pointer to the slot.
+ * @param list The version to publish, or NULL.
+ */
+void plPublish(plroot_t* root, plist_t* list);
+
+/**
+ * @brief Takes a reference to the current version in O(1). Never blocks plPublish().
+ * At most 65535 snapshots may be in progress on one slot at the same instant.
+ * @param root A pointer to the slot.
+ * @return The current version, to be dropped with plRelease(), or NULL if empty.
+ */
+plist_t* plSnapshot(plroot_t* root);
+
+/**
+ * @brief Releases the version held by a shared slot.
+ * Must only be called once no other thread is using the slot.
+ * @param root A pointer to the slot.
+ */
+void plRootDestroy(plroot_t* root);
+
+/**
+ * @brief Returns the number of references to the head node of a version, for debugging.
+ * Counts versions, shared slots and preceding nodes that refer to it.
+ * @param list The version.
+ * @return The reference count, or 0 for the empty list.
+ */
+int plRefs(plist_t* list);
+
+#endif /* PLIST_H */
@@ -0,0 +1,102 @@
+/**
+ * Seedable pseudo-random number generator
+ * @file rng.c
+*/
+
+#include "rng.h"
+
+// Rotates x left by k bits.
+static inline uint64_t rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+// Returns the next output of a splitmix64 sequence, used to expand seeds.
+static uint64_t splitmix64(uint64_t* x) {
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Seeds a generator.
+void rngSeed(rng_t* rng, uint64_t seed) {
+    // splitmix64 never yields four zero words in a row, so the state is valid
+    for (int i = 0; i < 4; i++) rng->s[i] = splitmix64(&seed);
+}
+
+// Returns the next 64 random bits.
+uint64_t rngNext(rng_t* rng) {
+    uint64_t* s = rng->s;
+    uint64_t result = rotl(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+    return result;
+}
+
+// Returns a uniformly distributed value below bound, without modulo bias.
+uint32_t rngBounded(rng_t* rng, uint32_t bound) {
+    // The high half of x * bound is uniform once the few low halves below
+    // 2^32 mod bound are rejected; the division only runs when one is hit
+    uint64_t m = (rngNext(rng) >> 32) * bound;
+    uint32_t low = (uint32_t)m;
+    if (low < bound) {
+        uint32_t threshold = -bound % bound;
+        while (low < threshold) {
+            m = (rngNext(rng) >> 32) * bound;
+            low = (uint32_t)m;
+        }
+    }
+    return (uint32_t)(m >> 32);
+}
+
+// Returns a uniformly distributed value from min to max inclusive.
+int rngRange(rng_t* rng, int min, int max) {
+    uint64_t span = (uint64_t)((int64_t)max - min) + 1;
+    uint32_t offset = span > UINT32_MAX ? (uint32_t)(rngNext(rng) >> 32)
+                                        : rngBounded(rng, (uint32_t)span);
+    return (int)((int64_t)min + offset);
+}
+
+// Advances a generator by 2^128 steps.
+void rngJump(rng_t* rng) {
+    static const uint64_t jump[4] = {
+        0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+        0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL
+    };
+    uint64_t s[4] = { 0, 0, 0, 0 };
+    for (int i = 0; i < 4; i++) {
+        for (int b = 0; b < 64; b++) {
+            if (jump[i] & (1ULL << b)) {
+                for (int w = 0; w < 4; w++) s[w] ^= rng->s[w];
+            }
+            rngNext(rng);
+        }
+    }
+    for (int w = 0; w < 4; w++) rng->s[w] = s[w];
+}
+
+// Fill an array of integers with random numbers ranging from min to max.
+void rngFill(rng_t* rng, int arr[], int size, int min, int max) {
+    for (int i = 0; i < size; i++) arr[i] = rngRange(rng, min, max);
+}
+
+// Shuffle the elements of an integer array.
+void rngShuffle(rng_t* rng, int arr[], int size) {
+    for (int i = size - 1; i > 0; i--) {
+        int j = (int)rngBounded(rng, (uint32_t)i + 1);
+        int temp = arr[i];
+        arr[i] = arr[j];
+        arr[j] = temp;
+    }
+}
+
+// Fill an array of integers with unique numbers ranging from 0 to size - 1.
+void rngUnique(rng_t* rng, int arr[], int size) {
+    for (int i = 0; i < size; i++) arr[i] = i;
+    rngShuffle(rng, arr, size);
+}
@@ -0,0 +1,88 @@
+/**
+ * Seedable pseudo-random number generator
+ * @file rng.h
+ * xoshiro256** with explicit state: every generator is an rng_t owned by the
+ * caller, so threads never share hidden state and a seed always reproduces the
+ * same sequence. Bounded values use Lemire's multiply-and-reject method, which
+ * is unbiased for every range. rngJump() advances a generator by 2^128 steps,
+ * giving non-overlapping streams for parallel fills.
+*/
+
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+
+/**
+ * A struct holding the state of one generator.
+*/
+typedef struct rng {
+    uint64_t s[4];      /**< xoshiro256** state; never all zero */
+} rng_t;
+
+/**
+ * @brief Seeds a generator. Any seed, including 0, gives a valid state.
+ * @param rng A pointer to the generator.
+ * @param seed The seed; equal seeds produce equal sequences.
+ */
+void rngSeed(rng_t* rng, uint64_t seed);
+
+/**
+ * @brief Returns the next 64 random bits.
+ * @param rng A pointer to the generator.
+ * @return A uniformly distributed 64-bit value.
+ */
+uint64_t rngNext(rng_t* rng);
+
+/**
+ * @brief Returns a uniformly distributed value below bound, without modulo bias.
+ * @param rng A pointer to the generator.
+ * @param bound The exclusive upper bound. Must be greater than 0.
+ * @return A value from 0 to bound - 1.
+ */
+uint32_t rngBounded(rng_t* rng, uint32_t bound);
+
+/**
+ * @brief Returns a uniformly distributed value from min to max inclusive.
+ * Any range works, including INT_MIN to INT_MAX.
+ * @param rng A pointer to the generator.
+ * @param min The minimum value.
+ * @param max The maximum value. Must not be less than min.
+ * @return A value from min to max.
+ */
+int rngRange(rng_t* rng, int min, int max);
+
+/**
+ * @brief Advances a generator by 2^128 steps.
+ * Jumping a copy k times gives the k-th of 2^128 non-overlapping streams.
+ * @param rng A pointer to the generator.
+ */
+void rngJump(rng_t* rng);
+
+/**
+ * @brief Fill an array of integers with random numbers ranging from min to max.
+ * @param rng A pointer to the generator.
+ * @param arr The array to be filled with random numbers.
+ * @param size The size of the array.
+ * @param min The minimum value of the random numbers.
+ * @param max The maximum value of the random numbers.
+ */
+void rngFill(rng_t* rng, int arr[], int size, int min, int max);
+
+/**
+ * @brief Shuffle the elements of an integer array with a Fisher-Yates shuffle.
+ * @param rng A pointer to the generator.
+ * @param arr The array to be shuffled.
+ * @param size The size of the array.
+ */
+void rngShuffle(rng_t* rng, int arr[], int size);
+
+/**
+ * @brief Fill an array of integers with unique numbers ranging from 0 to size - 1.
+ * @param rng A pointer to the generator.
+ * @param arr The array to be filled with unique numbers.
+ * @param size The size of the array.
+ */
+void rngUnique(rng_t* rng, int arr[], int size);
+
+#endif /* RNG_H */
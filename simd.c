@@ -0,0 +1,280 @@
+/**
+ * Vectorised scan kernels over contiguous int blocks
+ * @file simd.c
+*/
+
+#include <limits.h>
+#include <stdatomic.h>
+#include "simd.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+/**
+ * A struct holding the kernel set chosen for the running CPU.
+*/
+typedef struct kernels {
+    const char* name;
+    int (*count)(const int*, int, int);
+    int (*find)(const int*, int, int);
+    long long (*sum)(const int*, int);
+    int (*min)(const int*, int);
+    int (*max)(const int*, int);
+} kernels_t;
+
+// Scalar kernels, used as fallback and for the tail of vector loops.
+static int scalarCount(const int* arr, int size, int value) {
+    int n = 0;
+    for (int i = 0; i < size; i++) n += arr[i] == value;
+    return n;
+}
+
+static int scalarFind(const int* arr, int size, int value) {
+    for (int i = 0; i < size; i++) {
+        if (arr[i] == value) return i;
+    }
+    return -1;
+}
+
+static long long scalarSum(const int* arr, int size) {
+    long long sum = 0;
+    for (int i = 0; i < size; i++) sum += arr[i];
+    return sum;
+}
+
+static int scalarMin(const int* arr, int size) {
+    int min = arr[0];
+    for (int i = 1; i < size; i++) if (arr[i] < min) min = arr[i];
+    return min;
+}
+
+static int scalarMax(const int* arr, int size) {
+    int max = arr[0];
+    for (int i = 1; i < size; i++) if (arr[i] > max) max = arr[i];
+    return max;
+}
+
+static const kernels_t scalar_kernels = {
+    "scalar", scalarCount, scalarFind, scalarSum, scalarMin, scalarMax
+};
+
+#ifdef SIMD_X86
+// SSE2 kernels. SSE2 has no 32-bit min/max, so those use compare and select.
+__attribute__((target("sse2")))
+static int sse2Count(const int* arr, int size, int value) {
+    __m128i key = _mm_set1_epi32(value);
+    __m128i acc = _mm_setzero_si128();
+    int i = 0;
+    for (; i + 4 <= size; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)&arr[i]);
+        acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(v, key));   // Matches are -1
+    }
+    int lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + scalarCount(&arr[i], size - i, value);
+}
+
+__attribute__((target("sse2")))
+static int sse2Find(const int* arr, int size, int value) {
+    __m128i key = _mm_set1_epi32(value);
+    int i = 0;
+    for (; i + 4 <= size; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)&arr[i]);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, key)));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    int j = scalarFind(&arr[i], size - i, value);
+    return j < 0 ? -1 : i + j;
+}
+
+__attribute__((target("sse2")))
+static long long sse2Sum(const int* arr, int size) {
+    __m128i acc = _mm_setzero_si128();
+    int i = 0;
+    for (; i + 4 <= size; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)&arr[i]);
+        __m128i sign = _mm_srai_epi32(v, 31);               // Sign extend to 64 bits
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(v, sign));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(v, sign));
+    }
+    long long lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+    return lanes[0] + lanes[1] + scalarSum(&arr[i], size - i);
+}
+
+__attribute__((target("sse2")))
+static int sse2Min(const int* arr, int size) {
+    if (size < 4) return scalarMin(arr, size);
+    __m128i best = _mm_loadu_si128((const __m128i*)arr);
+    int i = 4;
+    for (; i + 4 <= size; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)&arr[i]);
+        __m128i lt = _mm_cmplt_epi32(v, best);
+        best = _mm_or_si128(_mm_and_si128(lt, v), _mm_andnot_si128(lt, best));
+    }
+    int lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, best);
+    int min = scalarMin(lanes, 4);
+    if (i < size) {
+        int rest = scalarMin(&arr[i], size - i);
+        if (rest < min) min = rest;
+    }
+    return min;
+}
+
+__attribute__((target("sse2")))
+static int sse2Max(const int* arr, int size) {
+    if (size < 4) return scalarMax(arr, size);
+    __m128i best = _mm_loadu_si128((const __m128i*)arr);
+    int i = 4;
+    for (; i + 4 <= size; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)&arr[i]);
+        __m128i gt = _mm_cmpgt_epi32(v, best);
+        best = _mm_or_si128(_mm_and_si128(gt, v), _mm_andnot_si128(gt, best));
+    }
+    int lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, best);
+    int max = scalarMax(lanes, 4);
+    if (i < size) {
+        int rest = scalarMax(&arr[i], size - i);
+        if (rest > max) max = rest;
+    }
+    return max;
+}
+
+static const kernels_t sse2_kernels = {
+    "sse2", sse2Count, sse2Find, sse2Sum, sse2Min, sse2Max
+};
+
+// AVX2 kernels, eight lanes per step.
+__attribute__((target("avx2")))
+static int avx2Count(const int* arr, int size, int value) {
+    __m256i key = _mm256_set1_epi32(value);
+    __m256i acc = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 8 <= size; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)&arr[i]);
+        acc = _mm256_sub_epi32(acc, _mm256_cmpeq_epi32(v, key));
+    }
+    int lanes[8];
+    _mm256_storeu_si256((__m256i*)lanes, acc);
+    int n = 0;
+    for (int k = 0; k < 8; k++) n += lanes[k];
+    return n + scalarCount(&arr[i], size - i, value);
+}
+
+__attribute__((target("avx2")))
+static int avx2Find(const int* arr, int size, int value) {
+    __m256i key = _mm256_set1_epi32(value);
+    int i = 0;
+    for (; i + 8 <= size; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)&arr[i]);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, key)));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    int j = scalarFind(&arr[i], size - i, value);
+    return j < 0 ? -1 : i + j;
+}
+
+__attribute__((target("avx2")))
+static long long avx2Sum(const int* arr, int size) {
+    __m256i acc = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 8 <= size; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)&arr[i]);
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    long long lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + scalarSum(&arr[i], size - i);
+}
+
+__attribute__((target("avx2")))
+static int avx2Min(const int* arr, int size) {
+    __m256i best = _mm256_set1_epi32(INT_MAX);
+    int i = 0;
+    for (; i + 8 <= size; i += 8) {
+        best = _mm256_min_epi32(best, _mm256_loadu_si256((const __m256i*)&arr[i]));
+    }
+    int lanes[8];
+    _mm256_storeu_si256((__m256i*)lanes, best);
+    int min = scalarMin(lanes, 8);
+    if (i < size) {
+        int rest = scalarMin(&arr[i], size - i);
+        if (rest < min) min = rest;
+    }
+    return min;
+}
+
+__attribute__((target("avx2")))
+static int avx2Max(const int* arr, int size) {
+    __m256i best = _mm256_set1_epi32(INT_MIN);
+    int i = 0;
+    for (; i + 8 <= size; i += 8) {
+        best = _mm256_max_epi32(best, _mm256_loadu_si256((const __m256i*)&arr[i]));
+    }
+    int lanes[8];
+    _mm256_storeu_si256((__m256i*)lanes, best);
+    int max = scalarMax(lanes, 8);
+    if (i < size) {
+        int rest = scalarMax(&arr[i], size - i);
+        if (rest > max) max = rest;
+    }
+    return max;
+}
+
+static const kernels_t avx2_kernels = {
+    "avx2", avx2Count, avx2Find, avx2Sum, avx2Min, avx2Max
+};
+#endif
+
+// Selects the best kernel set on first use.
+static const kernels_t* getKernels(void) {
+    static _Atomic(const kernels_t*) selected = NULL;
+    const kernels_t* kernels = atomic_load_explicit(&selected, memory_order_relaxed);
+    if (kernels == NULL) {
+#ifdef SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) kernels = &avx2_kernels;
+        else if (__builtin_cpu_supports("sse2")) kernels = &sse2_kernels;
+        else kernels = &scalar_kernels;
+#else
+        kernels = &scalar_kernels;
+#endif
+        atomic_store_explicit(&selected, kernels, memory_order_relaxed);
+    }
+    return kernels;
+}
+
+// Counts the number of occurences of a value in an int block.
+int simdCount(const int* arr, int size, int value) {
+    return getKernels()->count(arr, size, value);
+}
+
+// Finds the first occurence of a value in an int block.
+int simdFind(const int* arr, int size, int value) {
+    return getKernels()->find(arr, size, value);
+}
+
+// Sums the elements of an int block.
+long long simdSum(const int* arr, int size) {
+    return getKernels()->sum(arr, size);
+}
+
+// Finds the smallest element of a non-empty int block.
+int simdMin(const int* arr, int size) {
+    return getKernels()->min(arr, size);
+}
+
+// Finds the largest element of a non-empty int block.
+int simdMax(const int* arr, int size) {
+    return getKernels()->max(arr, size);
+}
+
+// Returns the name of the selected kernel set.
+const char* simdLevel(void) {
+    return getKernels()->name;
+}
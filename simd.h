@@ -0,0 +1,59 @@
+/**
+ * Vectorised scan kernels over contiguous int blocks
+ * @file simd.h
+ * The implementation (AVX2, SSE2 or scalar) is selected at runtime on first use,
+ * based on the features reported by the CPU.
+*/
+
+#ifndef SIMD_H
+#define SIMD_H
+
+/**
+ * @brief Counts the number of occurences of a value in an int block.
+ * @param arr A pointer to the first element of the block.
+ * @param size The number of elements in the block.
+ * @param value The value to search for.
+ * @return Number of occurences of the value in the block.
+ */
+int simdCount(const int* arr, int size, int value);
+
+/**
+ * @brief Finds the first occurence of a value in an int block.
+ * @param arr A pointer to the first element of the block.
+ * @param size The number of elements in the block.
+ * @param value The value to search for.
+ * @return The index of the first occurence, or -1 if the value is not found.
+ */
+int simdFind(const int* arr, int size, int value);
+
+/**
+ * @brief Sums the elements of an int block using 64-bit accumulation.
+ * @param arr A pointer to the first element of the block.
+ * @param size The number of elements in the block.
+ * @return The sum of all elements, 0 for an empty block.
+ */
+long long simdSum(const int* arr, int size);
+
+/**
+ * @brief Finds the smallest element of a non-empty int block.
+ * @param arr A pointer to the first element of the block.
+ * @param size The number of elements in the block, at least 1.
+ * @return The smallest element.
+ */
+int simdMin(const int* arr, int size);
+
+/**
+ * @brief Finds the largest element of a non-empty int block.
+ * @param arr A pointer to the first element of the block.
+ * @param size The number of elements in the block, at least 1.
+ * @return The largest element.
+ */
+int simdMax(const int* arr, int size);
+
+/**
+ * @brief Returns the name of the kernel set selected for this CPU.
+ * @return "avx2", "sse2" or "scalar".
+ */
+const char* simdLevel(void);
+
+#endif /* SIMD_H */
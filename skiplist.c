@@ -0,0 +1,184 @@
+/**
+ * Skip-list index over sorted singly linked lists
+ * @file skiplist.c
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include "skiplist.h"
+
+/**
+ * A struct representing the index levels above one node of the list.
+ * next[i] links to the following tower on level i + 1.
+*/
+typedef struct tower {
+    node_t* node;           // Base node this tower indexes, NULL for the header
+    int height;             // Number of index levels
+    struct tower* next[];
+} tower_t;
+
+/**
+ * A struct representing a skip-list index.
+*/
+struct skipindex {
+    node_t** head;          // The indexed list
+    int level;              // Highest level in use
+    uint64_t seed;          // State of the tower height generator
+    tower_t* header;        // Tower of height SKIP_MAX_LEVEL before every node
+};
+
+// Draws a tower height: 0 with probability 3/4, each further level 1/4 as likely.
+static int randomHeight(skipindex_t* index) {
+    uint64_t x = index->seed;       // xorshift64
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    index->seed = x;
+    return __builtin_ctzll(x | 1ULL << (2 * SKIP_MAX_LEVEL)) / 2;     // Two zero bits per level
+}
+
+// Allocates a tower of the given height over node.
+static tower_t* createTower(node_t* node, int height) {
+    tower_t* tower = malloc(sizeof(tower_t) + sizeof(tower_t*) * height);
+    if (tower == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in skip-list index\n");
+        return NULL;
+    }
+    tower->node = node;
+    tower->height = height;
+    for (int i = 0; i < height; i++) tower->next[i] = NULL;
+    return tower;
+}
+
+// Records, for every level, the last tower whose node holds a value below value
+// (or at most value when inclusive). Returns the lowest of them.
+static tower_t* findTowers(skipindex_t* index, int value, int inclusive,
+                           tower_t* update[SKIP_MAX_LEVEL]) {
+    tower_t* tower = index->header;
+    for (int i = index->level - 1; i >= 0; i--) {
+        tower_t* next;
+        while ((next = tower->next[i]) != NULL &&
+               (next->node->data < value || (inclusive && next->node->data == value))) {
+            tower = next;
+        }
+        update[i] = tower;
+    }
+    return tower;
+}
+
+// Returns the link to the first base node at or after the tower's node that
+// fails the same test as findTowers().
+static node_t** findLink(skipindex_t* index, tower_t* tower, int value, int inclusive) {
+    node_t** link = tower->node ? &tower->node->next : index->head;
+    while (*link != NULL && ((*link)->data < value || (inclusive && (*link)->data == value))) {
+        link = &(*link)->next;
+    }
+    return link;
+}
+
+// Builds an index over a sorted linked list in one pass.
+skipindex_t* skipBuild(node_t** head) {
+    skipindex_t* index = malloc(sizeof(skipindex_t));
+    tower_t* header = createTower(NULL, SKIP_MAX_LEVEL);
+    if (index == NULL || header == NULL) {
+        if (index == NULL) fprintf(stderr, "Error: Memory allocation failed in skipBuild\n");
+        free(index);
+        free(header);
+        return NULL;
+    }
+    index->head = head;
+    index->level = 0;
+    index->seed = 0x9E3779B97F4A7C15ULL ^ (uintptr_t)index;
+    index->header = header;
+
+    // Append each new tower after the last one on every level it reaches
+    tower_t* last[SKIP_MAX_LEVEL];
+    for (int i = 0; i < SKIP_MAX_LEVEL; i++) last[i] = header;
+    for (node_t* ptr = *head; ptr != NULL; ptr = ptr->next) {
+        int height = randomHeight(index);
+        if (height == 0) continue;
+        tower_t* tower = createTower(ptr, height);
+        if (tower == NULL) {
+            skipDestroy(&index);
+            return NULL;
+        }
+        for (int i = 0; i < height; i++) {
+            last[i]->next[i] = tower;
+            last[i] = tower;
+        }
+        if (height > index->level) index->level = height;
+    }
+    return index;
+}
+
+// Finds the first node holding a value greater than or equal to value.
+node_t* skipLowerBound(skipindex_t* index, int value) {
+    tower_t* update[SKIP_MAX_LEVEL];
+    return *findLink(index, findTowers(index, value, 0, update), value, 0);
+}
+
+// Finds the first node holding a value.
+node_t* skipFind(skipindex_t* index, int value) {
+    node_t* node = skipLowerBound(index, value);
+    return node != NULL && node->data == value ? node : NULL;
+}
+
+// Inserts a value in sorted order, after any equal values.
+int skipInsert(skipindex_t* index, int value) {
+    tower_t* update[SKIP_MAX_LEVEL];
+    node_t** link = findLink(index, findTowers(index, value, 1, update), value, 1);
+
+    int height = randomHeight(index);
+    node_t* new_node = malloc(sizeof(node_t));
+    tower_t* tower = height ? createTower(new_node, height) : NULL;
+    if (new_node == NULL || (height && tower == NULL)) {
+        if (new_node == NULL) fprintf(stderr, "Error: Memory allocation failed in skipInsert\n");
+        free(new_node);
+        return 1;
+    }
+    new_node->data = value;
+    new_node->next = *link;
+    *link = new_node;
+
+    // Levels above the current top start from the header
+    for (int i = index->level; i < height; i++) update[i] = index->header;
+    if (height > index->level) index->level = height;
+    for (int i = 0; i < height; i++) {
+        tower->next[i] = update[i]->next[i];
+        update[i]->next[i] = tower;
+    }
+    return 0;
+}
+
+// Deletes the first node holding a value.
+int skipDelete(skipindex_t* index, int value) {
+    tower_t* update[SKIP_MAX_LEVEL];
+    node_t** link = findLink(index, findTowers(index, value, 0, update), value, 0);
+    node_t* delete = *link;
+    if (delete == NULL || delete->data != value) return 1;
+
+    // The first equal node's tower, if any, directly follows update[] on each of its levels
+    tower_t* tower = index->level ? update[0]->next[0] : NULL;
+    if (tower != NULL && tower->node == delete) {
+        for (int i = 0; i < tower->height; i++) update[i]->next[i] = tower->next[i];
+        free(tower);
+        while (index->level > 0 && index->header->next[index->level - 1] == NULL) index->level--;
+    }
+    *link = delete->next;
+    free(delete);
+    return 0;
+}
+
+// Destroys an index, leaving the list itself intact.
+void skipDestroy(skipindex_t** index) {
+    if (*index == NULL) return;
+    tower_t* tower = (*index)->header;
+    while (tower != NULL) {
+        tower_t* next = tower->height ? tower->next[0] : NULL;
+        free(tower);
+        tower = next;
+    }
+    free(*index);
+    *index = NULL;
+}
@@ -0,0 +1,78 @@
+/**
+ * Skip-list index over sorted singly linked lists
+ * @file skiplist.h
+ * An optional index built over a list sorted in ascending order (e.g. by
+ * mergeSort()). The list itself stays the base level: index levels are towers
+ * of express links pointing at existing node_t nodes, so code that walks the
+ * list through ->next keeps working. About one node in four gets a tower, and
+ * each tower level is four times sparser than the one below it, giving
+ * expected O(log n) lookup, insert and delete.
+ *
+ * While an index exists, the list must only be modified through skipInsert()
+ * and skipDelete(); any other change (push(), deleteMatch(), ...) requires the
+ * index to be destroyed and rebuilt.
+ *
+ * Range iteration starts from skipLowerBound():
+ *     for (node_t* ptr = skipLowerBound(index, lo); ptr && ptr->data <= hi; ptr = ptr->next)
+*/
+
+#ifndef SKIPLIST_H
+#define SKIPLIST_H
+
+#include "sllist.h"
+
+#define SKIP_MAX_LEVEL 16   // Index levels above the base list; 4^16 covers any int count
+
+/**
+ * An opaque type representing a skip-list index.
+*/
+typedef struct skipindex skipindex_t;
+
+/**
+ * @brief Builds an index over a sorted linked list in one pass.
+ * The index keeps a pointer to head so that inserting or deleting at the front
+ * updates the caller's list.
+ * @param head A pointer to the head of a list sorted in ascending order. Passed by reference (e.g. &list).
+ * @return A pointer to the created index, or NULL upon memory allocation failure.
+ */
+skipindex_t* skipBuild(node_t** head);
+
+/**
+ * @brief Finds the first node holding a value.
+ * @param index A pointer to the index.
+ * @param value The value to search for.
+ * @return A pointer to the node, or NULL if the value is not in the list.
+ */
+node_t* skipFind(skipindex_t* index, int value);
+
+/**
+ * @brief Finds the first node holding a value greater than or equal to value.
+ * @param index A pointer to the index.
+ * @param value The lower bound.
+ * @return A pointer to the node, or NULL if every value is smaller.
+ */
+node_t* skipLowerBound(skipindex_t* index, int value);
+
+/**
+ * @brief Inserts a value in sorted order, after any equal values.
+ * @param index A pointer to the index.
+ * @param value The value to insert.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure (list unchanged).
+ */
+int skipInsert(skipindex_t* index, int value);
+
+/**
+ * @brief Deletes the first node holding a value.
+ * @param index A pointer to the index.
+ * @param value The value to delete.
+ * @return Returns 0 if a node was deleted. 1 if the value is not in the list.
+ */
+int skipDelete(skipindex_t* index, int value);
+
+/**
+ * @brief Destroys an index, leaving the list itself intact.
+ * @param index A pointer to the index. Passed by reference (e.g. &index).
+ */
+void skipDestroy(skipindex_t** index);
+
+#endif /* SKIPLIST_H */
@@ -5,10 +5,29 @@
  * @date 27th April 2023
 */
 
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdarg.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "sllist.h"
+#include "stats.h"
+#include "rng.h"
+
+#ifdef SLLIST_STATS
+// Route allocations through the counting wrappers in stats.c
+#define malloc(size) statMalloc(size)
+#define free(ptr) statFree(ptr)
+#endif
 
 // Creates a linked list based on input values.
 node_t* createSLL(char order, int size, ...) {
@@ -46,6 +65,13 @@ node_t* createSLL(char order, int size, ...) {
     return head;
 }
 
+// Counts nodes for internal use, so callers are not recorded as length() calls.
+static int countNodes(node_t* head) {
+    int n = 0;
+    for (; head != NULL; head = head->next) n++;
+    return n;
+}
+
 // Create a linked list using an array as input.
 node_t* createfromArray(int arr[], int size) {
     node_t* head = NULL;
@@ -62,6 +88,7 @@ node_t* createfromArray(int arr[], int size) {
 
 // Adds a node to the head of a linked list.
 int push(node_t** head, int data) {
+    STAT_OP(STAT_PUSH);
     // Initialise and allocate memory for new node.
     node_t* new_node = malloc(sizeof(node_t));
     if (new_node == NULL) {
@@ -85,6 +112,7 @@ int push(node_t** head, int data) {
 
 // Add node to tail of linked list.
 int enqueue(node_t** head, int data) {
+    STAT_OP(STAT_ENQUEUE);
     // Add node directly to empty list pointer
     if (*head == NULL) {
         push(head, data);   // This is essentially push to empty list.
@@ -101,6 +129,7 @@ int enqueue(node_t** head, int data) {
     node_t* ptr = *head;
     while (ptr->next != NULL) {
         ptr = ptr->next;
+        STAT_ADD(STAT_ENQUEUE, traversed, 1);
     }
     // Insert new_node to tail.
     ptr->next = new_node;
@@ -111,6 +140,7 @@ int enqueue(node_t** head, int data) {
 
 // Removes a node from the head of a linked list.
 int pop(node_t** head) {
+    STAT_OP(STAT_POP);
     if (*head == NULL) {
         fprintf(stderr, "Error: Cannot pop empty list.\n");
         return 1;
@@ -125,6 +155,7 @@ int pop(node_t** head) {
 
 // Removes a node from tail of linked list.
 int removeTail(node_t** head) {
+    STAT_OP(STAT_REMOVE_TAIL);
     if (*head == NULL) {    // Empty list
         fprintf(stderr, "Error: Cannot remove element from empty list.\n");
         return 1;
@@ -139,6 +170,7 @@ int removeTail(node_t** head) {
     else {              // List greater than one
         while (ptr->next->next != NULL) {   //Traverse to the second last node of list.
             ptr = ptr->next;
+            STAT_ADD(STAT_REMOVE_TAIL, traversed, 1);
         }
         free(ptr->next->next);  // Free last element
         ptr->next = NULL;
@@ -148,6 +180,7 @@ int removeTail(node_t** head) {
 
 // Deletes all nodes with a matching value in a linked list.
 void deleteMatch(node_t** head, int value) {
+    STAT_OP(STAT_DELETE_MATCH);
     if (*head == NULL) {
         fprintf(stderr, "Error: can't delete from empty list.\n");
     }
@@ -174,11 +207,13 @@ void deleteMatch(node_t** head, int value) {
             free(delete);                 // If tail nodes deleted, ptr -> NULL
         }
         else ptr = ptr->next;             // Only advance when next node isn't a match
+        STAT_ADD(STAT_DELETE_MATCH, traversed, 1);
     }
 }
 
 // Deletes all nodes that are duplicated in a linked list.
 void deleteDuplicates(node_t** head) {
+    STAT_OP(STAT_DELETE_DUPLICATES);
     // Do nothing if list is empty or only has one node
     if(!head || !(*head)->next) return;
 
@@ -189,6 +224,8 @@ void deleteDuplicates(node_t** head) {
         inner = outer;
 
         while (inner->next != NULL) {
+            STAT_ADD(STAT_DELETE_DUPLICATES, comparisons, 1);
+            STAT_ADD(STAT_DELETE_DUPLICATES, traversed, 1);
             if (outer->data == inner->next->data) {
                 dupe = inner->next;
                 inner->next = inner->next->next;
@@ -202,8 +239,98 @@ void deleteDuplicates(node_t** head) {
     }
 }
 
+// Creates an empty set with room for count values at a load factor of at most 0.5.
+int intsetInit(intset_t* set, size_t count) {
+    // Table size is a power of two at least twice count. The 32-bit hash addresses
+    // at most 2^32 slots, and the shift must stay below the width of size_t
+    int bits = 1;
+    while (bits < 32 && bits < (int)(sizeof(size_t) * CHAR_BIT) - 1 &&
+           ((size_t)1 << bits) / 2 < count) bits++;
+    size_t capacity = (size_t)1 << bits;
+
+    set->table = NULL;
+    if (capacity / 2 >= count && capacity <= SIZE_MAX / sizeof(int)) {
+        set->table = malloc(sizeof(int) * capacity);
+    }
+    if (set->table == NULL) return 1;
+    for (size_t i = 0; i < capacity; i++) {
+        set->table[i] = INT_MIN;    // INT_MIN marks an empty slot,
+    }
+    set->has_min = 0;               // so that value is tracked separately.
+    set->mask = capacity - 1;
+    set->bits = bits;
+    return 0;
+}
+
+// Adds a value to a set, returning 1 if it was already there.
+int intsetAdd(intset_t* set, int value) {
+    if (value == INT_MIN) {
+        int found = set->has_min;
+        set->has_min = 1;
+        return found;
+    }
+    // Fibonacci hashing, then linear probing
+    int* table = set->table;
+    size_t slot = ((uint32_t)value * 2654435769u) >> (32 - set->bits);
+    while (table[slot] != INT_MIN && table[slot] != value) {
+        slot = (slot + 1) & set->mask;
+        STAT_ADD(STAT_DELETE_DUPLICATES, comparisons, 1);
+    }
+    STAT_ADD(STAT_DELETE_DUPLICATES, comparisons, 1);
+    if (table[slot] == value) return 1;
+    table[slot] = value;
+    return 0;
+}
+
+// Deallocates the table of a set.
+void intsetDestroy(intset_t* set) {
+    free(set->table);
+    set->table = NULL;
+}
+
+// Deletes all duplicated nodes in a linked list using an open-addressing hash set.
+int deleteDuplicatesHash(node_t** head) {
+    STAT_OP(STAT_DELETE_DUPLICATES);
+    if (!*head || !(*head)->next) return 0;
+
+    intset_t seen;
+    if (intsetInit(&seen, (size_t)countNodes(*head))) {
+        fprintf(stderr, "Error: Memory allocation failed in deleteDuplicatesHash\n");
+        return 1;
+    }
+
+    node_t** link = head;
+    while (*link != NULL) {
+        if (intsetAdd(&seen, (*link)->data)) {
+            node_t* dupe = *link;
+            *link = dupe->next;     // Unlink without advancing
+            free(dupe);
+        }
+        else link = &(*link)->next;
+        STAT_ADD(STAT_DELETE_DUPLICATES, traversed, 1);
+    }
+
+    intsetDestroy(&seen);
+    return 0;
+}
+
+// Deletes all duplicated nodes in a sorted linked list.
+void deleteSortedDuplicates(node_t** head) {
+    STAT_OP(STAT_DELETE_DUPLICATES);
+    node_t* ptr = *head;
+    while (ptr != NULL && ptr->next != NULL) {
+        if (ptr->data == ptr->next->data) {
+            node_t* dupe = ptr->next;
+            ptr->next = dupe->next;
+            free(dupe);
+        }
+        else ptr = ptr->next;       // Only advance when next node differs
+    }
+}
+
 // Reverses the order of a linked list.
 void reverseList(node_t** head) {
+    STAT_OP(STAT_REVERSE);
     if (!*head || !(*head)->next) return; // If the list is empty or has only one node, do nothing and return
 
     node_t* ptr = *head;       // Pointer 'ptr' points to the current node
@@ -214,12 +341,14 @@ void reverseList(node_t** head) {
         ptr->next = prv;       // Reverse the current node's 'next' pointer
         prv = ptr;             // Move 'prv' to the current node
         ptr = *head;           // Update 'ptr' to the next node
+        STAT_ADD(STAT_REVERSE, traversed, 1);
     }
     *head = prv;               // Update 'head' to the new start of the reversed list
 }
 
 // Destroy a linked list, deallocating memory for all nodes.
 void destroy(node_t** head) {
+    STAT_OP(STAT_DESTROY);
     // Empty list
     if (*head == NULL) {
         fprintf(stderr, "Error: Cannot destroy empty list.\n");
@@ -233,8 +362,8 @@ void destroy(node_t** head) {
     *head = NULL;                // Must pass original head ptr by reference to update
 }                                // it to NULL after deleting all nodes.
 
-// Sorts linked list in ascending order using merge sort algorithm
-void mergeSort(node_t** head) {
+// Recursive body of mergeSort(), kept separate so one sort is counted once.
+static void mergeSortRecursive(node_t** head) {
     // Base case when list is empty or only one element
     if (!*head || !(*head)->next) return;
 
@@ -244,8 +373,8 @@ void mergeSort(node_t** head) {
     splitList(*head, &left, &right);
 
     //Recursively sort sublists
-    mergeSort(&left);
-    mergeSort(&right);
+    mergeSortRecursive(&left);
+    mergeSortRecursive(&right);
 
     // Merge sorted sublists
     merge(head, left, right);
@@ -253,6 +382,122 @@ void mergeSort(node_t** head) {
     return;
 }
 
+// Sorts linked list in ascending order using merge sort algorithm
+void mergeSort(node_t** head) {
+    STAT_OP(STAT_SORT);
+    mergeSortRecursive(head);
+}
+
+// Sorts linked list in ascending order using an LSD radix sort.
+void radixSort(node_t** head) {
+    STAT_OP(STAT_SORT);
+    if (!*head || !(*head)->next) return;
+
+    // Flipping the sign bit makes unsigned order match signed order.
+    // Find which bytes differ anywhere in the list, so constant digits can be skipped.
+    unsigned int first = (unsigned int)(*head)->data ^ 0x80000000u;
+    unsigned int differ = 0;
+    for (node_t* ptr = (*head)->next; ptr != NULL; ptr = ptr->next) {
+        differ |= ((unsigned int)ptr->data ^ 0x80000000u) ^ first;
+    }
+
+    node_t* heads[256];
+    node_t** tails[256];            // Address of the last next pointer in each bucket
+
+    for (int shift = 0; shift < 32; shift += 8) {
+        if (((differ >> shift) & 0xFF) == 0) continue;
+
+        for (int b = 0; b < 256; b++) {
+            heads[b] = NULL;
+            tails[b] = &heads[b];
+        }
+        // Distribute in list order, appending to each bucket's tail (stable)
+        for (node_t* ptr = *head; ptr != NULL; ptr = ptr->next) {
+            unsigned int b = (((unsigned int)ptr->data ^ 0x80000000u) >> shift) & 0xFF;
+            *tails[b] = ptr;
+            tails[b] = &ptr->next;
+        }
+        // Concatenate the buckets in order
+        node_t** link = head;
+        for (int b = 0; b < 256; b++) {
+            if (heads[b] == NULL) continue;
+            *link = heads[b];
+            link = tails[b];
+        }
+        *link = NULL;
+    }
+}
+
+// Sorts an array of sign-flipped keys with an LSD radix sort, skipping constant digits.
+// Returns the buffer holding the result, which is keys or tmp.
+static unsigned int* radixKeys(unsigned int* keys, unsigned int* tmp, int size) {
+    unsigned int differ = 0;
+    for (int i = 1; i < size; i++) differ |= keys[i] ^ keys[0];
+
+    for (int shift = 0; shift < 32; shift += 8) {
+        if (((differ >> shift) & 0xFF) == 0) continue;
+
+        int offsets[256] = { 0 };
+        for (int i = 0; i < size; i++) offsets[(keys[i] >> shift) & 0xFF]++;
+        for (int b = 0, sum = 0; b < 256; b++) {    // Prefix sums give each bucket's start
+            int n = offsets[b];
+            offsets[b] = sum;
+            sum += n;
+        }
+        for (int i = 0; i < size; i++) tmp[offsets[(keys[i] >> shift) & 0xFF]++] = keys[i];
+
+        unsigned int* swap = keys;
+        keys = tmp;
+        tmp = swap;
+    }
+    return keys;
+}
+
+// Sorts an array of sign-flipped keys with an insertion sort, for short lists.
+static void insertionKeys(unsigned int* keys, int size) {
+    for (int i = 1; i < size; i++) {
+        unsigned int key = keys[i];
+        int j = i - 1;
+        for (; j >= 0 && keys[j] > key; j--) keys[j + 1] = keys[j];
+        keys[j + 1] = key;
+    }
+}
+
+// Sorts the values of a linked list in a contiguous buffer; shared by arraySort() and
+// hybridSort() so that one call is counted once.
+static int sortValues(node_t** head) {
+    if (!*head || !(*head)->next) return 0;
+
+    int size = countNodes(*head);
+    unsigned int* keys = malloc(sizeof(unsigned int) * 2 * (size_t)size);
+    if (keys == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in arraySort\n");
+        return 1;
+    }
+    // Flipping the sign bit makes unsigned order match signed order
+    int i = 0;
+    for (node_t* ptr = *head; ptr != NULL; ptr = ptr->next) {
+        keys[i++] = (unsigned int)ptr->data ^ 0x80000000u;
+    }
+    unsigned int* sorted = keys;
+    if (size <= ARRAY_SORT_INSERTION) insertionKeys(keys, size);
+    else sorted = radixKeys(keys, keys + size, size);
+
+    // Write the values back in list order; the nodes stay where they are
+    i = 0;
+    for (node_t* ptr = *head; ptr != NULL; ptr = ptr->next) {
+        ptr->data = (int)(sorted[i++] ^ 0x80000000u);
+    }
+    free(keys);
+    return 0;
+}
+
+// Sorts a linked list by sorting its values in a contiguous buffer.
+int arraySort(node_t** head) {
+    STAT_OP(STAT_SORT);
+    return sortValues(head);
+}
+
 // Merges two sorted linked lists.
 void merge(node_t** head, node_t* left, node_t* right) {
     // If one of the subarrays is empty, return the non-empty one
@@ -265,6 +510,7 @@ void merge(node_t** head, node_t* left, node_t* right) {
         return;
     }
     // Initialize the head of the merged list with the smallest element
+    STAT_ADD(STAT_SORT, comparisons, 1);
     if (left->data <= right->data) {
         *head = left;
         left = left->next;
@@ -276,6 +522,7 @@ void merge(node_t** head, node_t* left, node_t* right) {
     // Traverse both subarrays and merge them in sorted order
     node_t* tail = *head;
     while (left && right) {
+        STAT_ADD(STAT_SORT, comparisons, 1);
         if (left->data <= right->data) {
             tail->next = left;
             left = left->next;
@@ -290,6 +537,101 @@ void merge(node_t** head, node_t* left, node_t* right) {
     tail->next = left ? left : right;
 }
 
+// Detaches the ascending run starting at head, returning its last node.
+static node_t* cutRun(node_t* head, node_t** rest) {
+    while (head->next && head->data <= head->next->data) {
+        head = head->next;
+    }
+    *rest = head->next;
+    head->next = NULL;
+    return head;
+}
+
+// Merges two sorted runs like merge(), also reporting the tail of the result.
+static node_t* mergeRuns(node_t* left, node_t* left_tail, node_t* right, node_t* right_tail,
+                         node_t** tail) {
+    node_t dummy;
+    node_t* ptr = &dummy;
+    while (left && right) {
+        STAT_ADD(STAT_SORT, comparisons, 1);
+        if (left->data <= right->data) {    // <= keeps the sort stable
+            ptr->next = left;
+            left = left->next;
+        }
+        else {
+            ptr->next = right;
+            right = right->next;
+        }
+        ptr = ptr->next;
+    }
+    // Attach the remainder, whose run tail is already known
+    ptr->next = left ? left : right;
+    *tail = left ? left_tail : right_tail;
+    return dummy.next;
+}
+
+// Sorts by merging natural runs bottom-up, returning the tail of the sorted list.
+// Runs are combined like a binary counter: bin k holds the merge of 2^k runs, so
+// merges happen while the nodes are still in cache and the list is walked once.
+static node_t* sortRuns(node_t** head) {
+    node_t* bins[64] = { NULL };
+    node_t* bin_tails[64];
+    int used = 0;                   // Number of bins in use
+    node_t* rest = *head;
+
+    while (rest) {
+        node_t* run = rest;
+        node_t* run_tail = cutRun(run, &rest);
+        // Carry: bins hold older (leftward) runs, so they are merged on the left
+        int k = 0;
+        while (k < used && bins[k] != NULL) {
+            run = mergeRuns(bins[k], bin_tails[k], run, run_tail, &run_tail);
+            bins[k] = NULL;
+            k++;
+        }
+        if (k == used) used++;
+        bins[k] = run;
+        bin_tails[k] = run_tail;
+    }
+
+    // Merge the remaining bins, oldest (highest) on the left
+    node_t* result = NULL;
+    node_t* tail = NULL;
+    for (int k = 0; k < used; k++) {
+        if (bins[k] == NULL) continue;
+        if (result == NULL) {
+            result = bins[k];
+            tail = bin_tails[k];
+        }
+        else result = mergeRuns(bins[k], bin_tails[k], result, tail, &tail);
+    }
+    *head = result;
+    return tail;
+}
+
+// Sorts linked list using an iterative bottom-up natural merge sort.
+void naturalMergeSort(node_t** head) {
+    STAT_OP(STAT_SORT);
+    if (!*head || !(*head)->next) return;
+    sortRuns(head);
+}
+
+// Sorts a linked list, choosing the algorithm by its length.
+void hybridSort(node_t** head) {
+    STAT_OP(STAT_SORT);
+    // One walk counts up to the threshold and, while the order holds, checks whether the
+    // list is already non-decreasing: then naturalMergeSort() would find a single run and
+    // change nothing, so copying it to an array would be pure overhead
+    int n = 0, sorted = 1;
+    for (node_t* ptr = *head; ptr != NULL && (sorted || n < HYBRID_SORT_THRESHOLD); ptr = ptr->next) {
+        if (ptr->next != NULL && ptr->data > ptr->next->data) sorted = 0;
+        if (n < HYBRID_SORT_THRESHOLD) n++;
+    }
+    if (sorted) return;
+    // Lists shorter than the threshold are cheaper to merge in place than to copy
+    if (n < HYBRID_SORT_THRESHOLD || sortValues(head)) sortRuns(head);
+}
+
 // Splits a linked list into two sub-list halves.
 void splitList(node_t* head, node_t** left, node_t** right) {
     // Return if list is empty or has only one element.
@@ -300,6 +642,7 @@ void splitList(node_t* head, node_t** left, node_t** right) {
     node_t* tortoise = head;
     while (hare) {
         hare = hare->next;
+        STAT_ADD(STAT_SORT, traversed, 1);
         if (hare) {
             hare = hare->next;
             tortoise = tortoise->next;
@@ -329,6 +672,7 @@ void splitList(node_t* head, node_t** left, node_t** right) {
 
 //Counts number of elements in the linked list.
 int length(node_t* head) {
+    STAT_OP(STAT_LENGTH);
     if (head == NULL) {         // Passes head pointer BY VALUE, creates a local copy
         return 0;               // This local head pointer can iterate through each
     }                           // node in the original linked list (not copied).
@@ -338,11 +682,13 @@ int length(node_t* head) {
         head = head->next;      // node_t* ptr = head; to make this clear ?
         i++;
     }
+    STAT_ADD(STAT_LENGTH, traversed, i);
     return i;
 }
 
 // Counts numbers of occurences of a given value in linked list.
 int count(node_t* head, int value) {
+    STAT_OP(STAT_COUNT);
     if (head == NULL) {
         fprintf(stderr, "Cannot use count function in empty list\n");
         return -1;
@@ -354,12 +700,14 @@ int count(node_t* head, int value) {
             i++;
         }
         head = head->next;
+        STAT_ADD(STAT_COUNT, traversed, 1);
     }
     return i;
 }
 
 // Saves content of a linked list to a file.
 void savetoFile(node_t* head, char *filename) {
+    STAT_OP(STAT_SAVE);
     if(head == NULL) {
         fprintf(stderr, "Error: Empty list, could not save to output.\n");
         return;
@@ -372,15 +720,167 @@ void savetoFile(node_t* head, char *filename) {
     }
 
     while (head != NULL) {
-        fprintf(output, "%d\n", head->data);
+        int written = fprintf(output, "%d\n", head->data);
+        STAT_ADD(STAT_SAVE, bytes_written, written > 0 ? written : 0);
         head = head->next;
     }
 
     fclose(output);
 }
 
+#define WRITE_BUFFER (1 << 20)      // Bytes formatted before each flush in savetoFileFast
+
+static const char digit_pairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Formats an int followed by a newline into out, returning the number of chars written.
+static int formatInt(char* out, int value) {
+    char temp[12];
+    char* ptr = temp + sizeof(temp);
+    // Work on the magnitude as unsigned so INT_MIN is handled
+    unsigned int n = value < 0 ? 0u - (unsigned int)value : (unsigned int)value;
+
+    while (n >= 100) {              // Two digits per division
+        unsigned int pair = (n % 100) * 2;
+        n /= 100;
+        *--ptr = digit_pairs[pair + 1];
+        *--ptr = digit_pairs[pair];
+    }
+    if (n >= 10) {
+        *--ptr = digit_pairs[n * 2 + 1];
+        *--ptr = digit_pairs[n * 2];
+    }
+    else *--ptr = (char)('0' + n);
+    if (value < 0) *--ptr = '-';
+
+    int len = (int)(temp + sizeof(temp) - ptr);
+    memcpy(out, ptr, len);
+    out[len] = '\n';
+    return len + 1;
+}
+
+// Writes a whole buffer, retrying on partial writes.
+static int writeAll(int fd, const char* buffer, size_t size) {
+    while (size > 0) {
+        ssize_t n = write(fd, buffer, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return 1;
+        }
+        STAT_ADD(STAT_SAVE, bytes_written, n);
+        buffer += n;
+        size -= n;
+    }
+    return 0;
+}
+
+// fsyncs the directory containing path, so a rename into it is durable.
+static int syncDirectory(const char* path) {
+    const char* slash = strrchr(path, '/');
+    // Copy with malloc rather than strdup, which the stats build cannot count
+    const char* source = slash == NULL ? "." : path;
+    size_t size = slash == NULL || slash == path ? 1 : (size_t)(slash - path);
+    char* dir = malloc(size + 1);
+    if (dir == NULL) return 1;
+    memcpy(dir, source, size);
+    dir[size] = '\0';
+
+    int fd = open(dir, O_RDONLY);
+    free(dir);
+    if (fd < 0) return 1;
+    int error = fsync(fd) != 0;
+    close(fd);
+    return error;
+}
+
+static _Atomic unsigned long temp_counter;
+
+// Creates a new file named after filename with mode 0666, so the umask applies as with open().
+static int openTemporary(char* name, size_t size, const char* filename) {
+    for (int attempt = 0; attempt < 100; attempt++) {
+        snprintf(name, size, "%s.tmp%ld.%lu", filename, (long)getpid(),
+                 atomic_fetch_add(&temp_counter, 1));
+        int fd = open(name, O_WRONLY | O_CREAT | O_EXCL, 0666);
+        if (fd >= 0 || errno != EEXIST) return fd;
+    }
+    return -1;
+}
+
+// Saves content of a linked list to a file using buffered write calls.
+int savetoFileFast(node_t* head, char* filename, int flags) {
+    STAT_OP(STAT_SAVE);
+    if (head == NULL) {
+        fprintf(stderr, "Error: Empty list, could not save to output.\n");
+        return SAVE_EMPTY;
+    }
+
+    char* buffer = malloc(WRITE_BUFFER);
+    char* temp_name = NULL;
+    if (buffer == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in savetoFileFast\n");
+        return SAVE_WRITE_ERR;
+    }
+
+    int fd;
+    if (flags & SAVE_ATOMIC) {
+        // Temporary file lives next to the target so rename stays atomic
+        size_t size = strlen(filename) + sizeof(".tmp.") + 2 * 20;
+        temp_name = malloc(size);
+        if (temp_name == NULL) {
+            free(buffer);
+            return SAVE_WRITE_ERR;
+        }
+        fd = openTemporary(temp_name, size, filename);
+        // Match the non-atomic path: keep an existing target's mode, else 0666 minus umask
+        struct stat target;
+        if (fd >= 0 && stat(filename, &target) == 0) fchmod(fd, target.st_mode & 07777);
+    }
+    else {
+        fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    }
+    if (fd < 0) {
+        fprintf(stderr, "Error: Unable to open file for writing.\n");
+        free(temp_name);
+        free(buffer);
+        return SAVE_OPEN_ERR;
+    }
+
+    int result = SAVE_OK;
+    size_t used = 0;
+    while (head != NULL) {
+        if (WRITE_BUFFER - used < 12) {     // Longest line is "-2147483648\n"
+            if (writeAll(fd, buffer, used)) {
+                result = SAVE_WRITE_ERR;
+                break;
+            }
+            used = 0;
+        }
+        used += formatInt(buffer + used, head->data);
+        head = head->next;
+    }
+    if (result == SAVE_OK && writeAll(fd, buffer, used)) result = SAVE_WRITE_ERR;
+    if (result == SAVE_OK && (flags & SAVE_FSYNC) && fsync(fd) != 0) result = SAVE_WRITE_ERR;
+    if (close(fd) != 0 && result == SAVE_OK) result = SAVE_WRITE_ERR;
+
+    if (temp_name != NULL) {
+        if (result == SAVE_OK && rename(temp_name, filename) != 0) result = SAVE_RENAME_ERR;
+        if (result != SAVE_OK) unlink(temp_name);
+        else if ((flags & SAVE_FSYNC) && syncDirectory(filename)) result = SAVE_WRITE_ERR;
+    }
+
+    if (result != SAVE_OK) {
+        fprintf(stderr, "Error: Failed to write list to file.\n");
+    }
+    free(temp_name);
+    free(buffer);
+    return result;
+}
+
 // Creates a singly linked list from the content of a file.
 node_t* createfromFile(char* input) {
+    STAT_OP(STAT_LOAD);
     FILE* file = fopen(input, "r");
     if (file == NULL) {
         fprintf(stderr, "Error: Unable to open file.\n");
@@ -396,6 +896,7 @@ node_t* createfromFile(char* input) {
         else size++;
     }
     // Reset file ptr, create array of size
+    STAT_ADD(STAT_LOAD, bytes_read, 2 * (unsigned long long)ftell(file));   // Scanned twice
     rewind(file);
     int* arr = malloc(sizeof(int) * size);
     int i = 0;
@@ -412,6 +913,253 @@ node_t* createfromFile(char* input) {
     return head;
 }
 
+#define STREAM_BUFFER (1 << 16)     // Bytes read per block by the streaming loader
+
+// Links a new node holding data after *link and advances link to its next pointer.
+static int appendNode(node_t*** link, int data) {
+    node_t* new_node = malloc(sizeof(node_t));
+    if (new_node == NULL) return 1;
+    new_node->data = data;
+    **link = new_node;
+    *link = &new_node->next;
+    return 0;
+}
+
+// Parses whitespace separated ints from a FILE* (or fd when stream is NULL), passing
+// each valid one to emit. Returns 0, or 1 on a read or allocation error or if emit fails.
+// Inlined so that loadStream() appends with a direct call rather than through emit.
+static inline int scanInts(FILE* stream, int fd, int (*emit)(void*, int), void* ctx) {
+    STAT_OP(STAT_LOAD);
+    char* buffer = malloc(STREAM_BUFFER);
+    if (buffer == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in the stream scanner\n");
+        return 1;
+    }
+
+    // Token state is kept across blocks so numbers may span buffer boundaries
+    long long value = 0;
+    int negative = 0, digits = 0, in_token = 0, invalid = 0;
+    int error = 0;
+
+    while (!error) {
+        ssize_t n;
+        // A signal interrupting the read is retried rather than ending the load
+        if (stream != NULL) {
+            n = fread(buffer, 1, STREAM_BUFFER, stream);
+            if (n == 0 && ferror(stream)) {
+                if (errno == EINTR) {
+                    clearerr(stream);
+                    continue;
+                }
+                error = 1;
+            }
+        }
+        else {
+            do {
+                n = read(fd, buffer, STREAM_BUFFER);
+            } while (n < 0 && errno == EINTR);
+            if (n < 0) error = 1;
+        }
+        if (n <= 0) break;
+        STAT_ADD(STAT_LOAD, bytes_read, n);
+
+        for (ssize_t i = 0; i < n && !error; i++) {
+            char ch = buffer[i];
+            if (ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r' || ch == '\v' || ch == '\f') {
+                if (digits && !invalid) {
+                    error = emit(ctx, (int)(negative ? -value : value));
+                }
+                value = 0;
+                negative = digits = in_token = invalid = 0;
+                continue;
+            }
+
+            if (!in_token) {            // First character of a token may be a sign
+                in_token = 1;
+                if (ch == '-' || ch == '+') {
+                    negative = ch == '-';
+                    continue;
+                }
+            }
+            if (ch >= '0' && ch <= '9' && !invalid) {
+                value = value * 10 + (ch - '0');
+                digits++;
+                // Values outside the int range make the token invalid
+                if (value > (long long)INT_MAX + negative) invalid = 1;
+            }
+            else invalid = 1;           // Non-valid tokens are skipped whole
+        }
+    }
+
+    // Flush a final token not followed by whitespace
+    if (!error && digits && !invalid) {
+        error = emit(ctx, (int)(negative ? -value : value));
+    }
+    free(buffer);
+    return error;
+}
+
+// Appends one scanned value to the list whose tail link ctx points to.
+static int appendValue(void* ctx, int data) {
+    return appendNode(ctx, data);
+}
+
+// Builds a list from whitespace separated ints in a FILE* (or fd when stream is NULL).
+static node_t* loadStream(FILE* stream, int fd) {
+    STAT_OP(STAT_LOAD);
+    node_t* head = NULL;
+    node_t** link = &head;          // Append each value to the tail as it goes
+    int error = scanInts(stream, fd, appendValue, &link);
+    *link = NULL;
+
+    if (error) {
+        fprintf(stderr, "Error: Failed to read list from stream.\n");
+        if (head) destroy(&head);
+        return NULL;
+    }
+    return head;
+}
+
+// Creates a singly linked list from a text stream in a single pass.
+node_t* createfromStream(FILE* stream) {
+    return loadStream(stream, -1);
+}
+
+// Creates a singly linked list from a text file descriptor in a single pass.
+node_t* createfromFd(int fd) {
+    return loadStream(NULL, fd);
+}
+
+// Reads whitespace-separated ints from a text stream, passing each valid one to a callback.
+int scanStream(FILE* stream, int (*emit)(void* ctx, int value), void* ctx) {
+    return scanInts(stream, -1, emit, ctx);
+}
+
+// Binary list file header, followed by count packed int32 values.
+typedef struct binheader {
+    char magic[4];          // "SLLB"
+    uint32_t version;
+    uint64_t count;
+    uint32_t checksum;      // FNV-1a over the payload, one 32-bit word at a time
+    uint32_t reserved;
+} binheader_t;
+
+#define BIN_MAGIC "SLLB"
+#define BIN_VERSION 1
+#define BIN_CHUNK 4096      // Ints buffered per fwrite in savetoBinary
+
+// Folds a block of ints into an FNV-1a checksum.
+static uint32_t checksumInts(uint32_t hash, const int32_t* arr, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        hash ^= (uint32_t)arr[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Saves content of a linked list to a binary file.
+int savetoBinary(node_t* head, char* filename) {
+    STAT_OP(STAT_SAVE);
+    if (head == NULL) {
+        fprintf(stderr, "Error: Empty list, could not save to output.\n");
+        return 1;
+    }
+
+    FILE* output = fopen(filename, "wb");
+    if (output == NULL) {
+        fprintf(stderr, "Error: Unable to open file for writing.\n");
+        return 1;
+    }
+
+    // Header is written last, once count and checksum are known
+    binheader_t header = { BIN_MAGIC, BIN_VERSION, 0, 2166136261u, 0 };
+    int32_t buffer[BIN_CHUNK];
+    int error = fseek(output, sizeof(header), SEEK_SET) != 0;
+
+    while (head != NULL && !error) {
+        size_t n = 0;
+        while (head != NULL && n < BIN_CHUNK) {
+            buffer[n++] = head->data;
+            head = head->next;
+        }
+        header.checksum = checksumInts(header.checksum, buffer, n);
+        header.count += n;
+        error = fwrite(buffer, sizeof(int32_t), n, output) != n;
+        STAT_ADD(STAT_SAVE, bytes_written, n * sizeof(int32_t));
+    }
+
+    if (!error) {
+        error = fseek(output, 0, SEEK_SET) != 0
+             || fwrite(&header, sizeof(header), 1, output) != 1;
+        STAT_ADD(STAT_SAVE, bytes_written, sizeof(header));
+    }
+    if (fclose(output) != 0) error = 1;
+    if (error) {
+        fprintf(stderr, "Error: Failed to write binary list file.\n");
+        return 1;
+    }
+    return 0;
+}
+
+// Creates a singly linked list from a memory mapped binary file.
+node_t* createfromBinary(char* input) {
+    STAT_OP(STAT_LOAD);
+    int fd = open(input, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "Error: Unable to open file.\n");
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(binheader_t)) {
+        fprintf(stderr, "Error: Not a binary list file.\n");
+        close(fd);
+        return NULL;
+    }
+    size_t size = st.st_size;
+    void* map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);                      // The mapping stays valid after close
+    if (map == MAP_FAILED) {
+        fprintf(stderr, "Error: Unable to map file.\n");
+        return NULL;
+    }
+    posix_madvise(map, size, POSIX_MADV_SEQUENTIAL);
+    STAT_ADD(STAT_LOAD, bytes_read, size);
+
+    binheader_t header;
+    memcpy(&header, map, sizeof(header));
+    const int32_t* payload = (const int32_t*)((const char*)map + sizeof(header));
+    node_t* head = NULL;
+
+    if (memcmp(header.magic, BIN_MAGIC, 4) != 0 || header.version != BIN_VERSION
+        || header.count != (size - sizeof(header)) / sizeof(int32_t)) {
+        fprintf(stderr, "Error: Not a binary list file.\n");
+    }
+    else if (checksumInts(2166136261u, payload, header.count) != header.checksum) {
+        fprintf(stderr, "Error: Checksum mismatch in binary list file.\n");
+    }
+    else {
+        // Build in payload order, linking each node to the tail
+        node_t** link = &head;
+        for (uint64_t i = 0; i < header.count; i++) {
+            node_t* new_node = malloc(sizeof(node_t));
+            if (new_node == NULL) {
+                fprintf(stderr, "Error: failed to create list\n");
+                *link = NULL;
+                if (head) destroy(&head);
+                break;
+            }
+            new_node->data = payload[i];
+            *link = new_node;
+            link = &new_node->next;
+        }
+        if (head) *link = NULL;
+    }
+
+    munmap(map, size);
+    return head;
+}
+
 // Recursively counts the number of occurrences of a specific value in a linked list.
 int recursive_count(node_t* head, int value) {
     if (head == NULL) return 0;
@@ -480,30 +1228,558 @@ int length_old(node_t** head) {
     return i;
 }
 
-// Fill an array of integers with unique numbers ranging from 0 to size - 1.
-void randomUnique(int arr[], int size) {
+static _Thread_local rng_t thread_rng;
+static _Thread_local int thread_seeded;
 
-    for (int i = 0; i < size; i++) {
-        arr[i] = i;
+// Returns the calling thread's generator. Until randomSeed() is called it is
+// seeded from rand() on first use, so srand() still picks the data as it did before.
+static rng_t* threadRng(void) {
+    if (!thread_seeded) {
+        randomSeed(((unsigned long long)rand() << 32) ^ (unsigned long long)rand());
     }
-    shuffle(arr, size);
+    return &thread_rng;
+}
+
+// Seeds the calling thread's generator.
+void randomSeed(unsigned long long seed) {
+    rngSeed(&thread_rng, seed);
+    thread_seeded = 1;
+}
+
+// Fill an array of integers with unique numbers ranging from 0 to size - 1.
+void randomUnique(int arr[], int size) {
+    rngUnique(threadRng(), arr, size);
 }
 
 // Fill an array of integers with random numbers ranging from min to max.
 void randomArray(int arr[], int size, int min, int max) {
-    for (int i = 0; i < size; i++) {
-        // (max - min + 1) is inclusive range. + min shifts number.
-        arr[i] = rand() % (max - min + 1) + min;
-    }
-    shuffle(arr, size);
+    rngFill(threadRng(), arr, size, min, max);
 }
 
 // Shuffle the elements of an integer array.
 void shuffle(int arr[], int size) {
-    for (int i = size - 1; i > 0; i--) {
-        int j = rand() % (i + 1);
-        int temp = arr[i];
-        arr[i] = arr[j];
-        arr[j] = temp;
+    rngShuffle(threadRng(), arr, size);
+}
+
+// Creates a node pool that allocates nodes in slabs.
+nodepool_t* createPool(int slab_size) {
+    nodepool_t* pool = malloc(sizeof(nodepool_t));
+    if (pool == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in createPool\n");
+        return NULL;
+    }
+    pool->slabs = NULL;
+    pool->free_list = NULL;
+    pool->slab_size = slab_size > 0 ? slab_size : 1024;
+    return pool;
+}
+
+// Allocates a node from a node pool.
+node_t* poolAlloc(nodepool_t* pool) {
+    // Reuse a released node first
+    if (pool->free_list != NULL) {
+        node_t* node = pool->free_list;
+        pool->free_list = node->next;
+        return node;
+    }
+    // Start a new slab when the current one is exhausted
+    if (pool->slabs == NULL || pool->slabs->used == pool->slab_size) {
+        slab_t* slab = malloc(sizeof(slab_t) + sizeof(node_t) * pool->slab_size);
+        if (slab == NULL) {
+            fprintf(stderr, "Error: Memory allocation failed in poolAlloc\n");
+            return NULL;
+        }
+        slab->used = 0;
+        slab->next = pool->slabs;
+        pool->slabs = slab;
+    }
+    return &pool->slabs->nodes[pool->slabs->used++];
+}
+
+// Returns a node to the free list of its pool.
+void poolFree(nodepool_t* pool, node_t* node) {
+    node->next = pool->free_list;   // The free list is intrusive: released nodes
+    pool->free_list = node;         // are chained through their own next pointer.
+}
+
+// Destroys a node pool, releasing every slab at once.
+void destroyPool(nodepool_t** pool) {
+    if (*pool == NULL) return;
+
+    slab_t* slab = (*pool)->slabs;
+    while (slab != NULL) {          // One free per slab rather than one per node.
+        slab_t* delete = slab;
+        slab = slab->next;
+        free(delete);
     }
-}
\ No newline at end of file
+    free(*pool);
+    *pool = NULL;
+}
+
+// Adds a pool allocated node to the head of a linked list.
+int poolPush(nodepool_t* pool, node_t** head, int data) {
+    STAT_OP(STAT_PUSH);
+    node_t* new_node = poolAlloc(pool);
+    if (new_node == NULL) return 1;
+
+    new_node->data = data;
+    new_node->next = *head;
+    *head = new_node;
+    return 0;
+}
+
+// Adds a pool allocated node to the tail of a linked list.
+int poolEnqueue(nodepool_t* pool, node_t** head, int data) {
+    STAT_OP(STAT_ENQUEUE);
+    node_t* new_node = poolAlloc(pool);
+    if (new_node == NULL) return 1;
+
+    new_node->data = data;
+    new_node->next = NULL;
+    // Traverse to the last link (head itself for an empty list)
+    node_t** link = head;
+    while (*link != NULL) {
+        link = &(*link)->next;
+        STAT_ADD(STAT_ENQUEUE, traversed, 1);
+    }
+    *link = new_node;
+    return 0;
+}
+
+// Removes the head node of a linked list, returning it to the pool.
+int poolPop(nodepool_t* pool, node_t** head) {
+    STAT_OP(STAT_POP);
+    if (*head == NULL) {
+        fprintf(stderr, "Error: Cannot pop empty list.\n");
+        return 1;
+    }
+
+    node_t* delete = *head;
+    *head = (*head)->next;
+    poolFree(pool, delete);
+    return 0;
+}
+
+// Create a linked list from an array using pool allocated nodes.
+node_t* createfromArrayPool(nodepool_t* pool, int arr[], int size) {
+    node_t* head = NULL;
+    for (int i = size - 1; i >= 0; i--) {
+        if (poolPush(pool, &head, arr[i])) {
+            fprintf(stderr, "Error: failed to create list\n");
+            poolDestroyList(pool, &head);
+            return NULL;
+        }
+    }
+
+    return head;
+}
+
+// Returns every node of a linked list to the pool's free list.
+void poolDestroyList(nodepool_t* pool, node_t** head) {
+    while (*head != NULL) {
+        node_t* delete = *head;
+        *head = (*head)->next;
+        poolFree(pool, delete);
+    }
+}
+
+// Initialises a list handle to an empty list.
+void initList(sllist_t* list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->count = 0;
+}
+
+// Adds a node to the head of a list handle.
+int listPush(sllist_t* list, int data) {
+    STAT_OP(STAT_PUSH);
+    if (push(&list->head, data)) return 1;
+
+    if (list->tail == NULL) {       // First node is both head and tail
+        list->tail = list->head;
+    }
+    list->count++;
+    return 0;
+}
+
+// Adds a node to the tail of a list handle.
+int listEnqueue(sllist_t* list, int data) {
+    STAT_OP(STAT_ENQUEUE);
+    node_t* new_node = malloc(sizeof(node_t));
+    if (new_node == NULL) {
+        fprintf(stderr, "Error: Failed to allocate memory in listEnqueue.\n");
+        return 1;
+    }
+    new_node->data = data;
+    new_node->next = NULL;
+
+    if (list->tail == NULL) {       // Empty list
+        list->head = new_node;
+    }
+    else {                          // Tail pointer removes the need to traverse
+        list->tail->next = new_node;
+    }
+    list->tail = new_node;
+    list->count++;
+    return 0;
+}
+
+// Removes a node from the head of a list handle.
+int listPop(sllist_t* list) {
+    STAT_OP(STAT_POP);
+    if (pop(&list->head)) return 1;
+
+    if (list->head == NULL) {       // Popped the only node
+        list->tail = NULL;
+    }
+    list->count--;
+    return 0;
+}
+
+// Returns the number of elements in a list handle.
+int listLength(sllist_t* list) {
+    return list->count;
+}
+
+// Deletes all nodes with a matching value from a list handle.
+void listDeleteMatch(sllist_t* list, int value) {
+    STAT_OP(STAT_DELETE_MATCH);
+    node_t** link = &list->head;
+    node_t* last = NULL;            // Last node kept, becomes the new tail
+
+    while (*link != NULL) {
+        if ((*link)->data == value) {
+            node_t* delete = *link;
+            *link = delete->next;   // Unlink without advancing
+            free(delete);
+            list->count--;
+        }
+        else {
+            last = *link;
+            link = &(*link)->next;
+        }
+    }
+    list->tail = last;
+}
+
+// Reverses the order of a list handle.
+void listReverse(sllist_t* list) {
+    list->tail = list->head;        // Old head becomes the new tail
+    reverseList(&list->head);
+}
+
+// Sorts a list handle in ascending order.
+void listSort(sllist_t* list) {
+    if (list->count < 2) return;
+
+    list->tail = sortRuns(&list->head);
+}
+
+// Destroys a list handle, deallocating all nodes.
+void listDestroy(sllist_t* list) {
+    STAT_OP(STAT_DESTROY);
+    while (list->head != NULL) {
+        node_t* delete = list->head;
+        list->head = list->head->next;
+        free(delete);
+    }
+    initList(list);
+}
+
+// Allocates one block holding size linked nodes and adds it to the block chain.
+static node_t* buildBlock(int arr[], int size, slab_t** blocks, node_t** last) {
+    slab_t* block = malloc(sizeof(slab_t) + sizeof(node_t) * size);
+    if (block == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for node block\n");
+        return NULL;
+    }
+    block->used = size;
+    block->next = *blocks;
+    *blocks = block;
+
+    // Single forward pass: each node links to its neighbour in the block
+    node_t* nodes = block->nodes;
+    for (int i = 0; i < size; i++) {
+        nodes[i].data = arr[i];
+        nodes[i].next = &nodes[i + 1];
+    }
+    nodes[size - 1].next = NULL;
+    *last = &nodes[size - 1];
+    return nodes;
+}
+
+// Creates a linked list from an array using one contiguous allocation.
+node_t* createfromArrayBlock(int arr[], int size, slab_t** blocks) {
+    STAT_OP(STAT_PUSH);
+    if (size <= 0) return NULL;
+    node_t* last;
+    return buildBlock(arr, size, blocks, &last);
+}
+
+// Appends an array to the tail of a linked list using one allocation.
+int appendArray(node_t** head, int arr[], int size, slab_t** blocks) {
+    STAT_OP(STAT_ENQUEUE);
+    if (size <= 0) return 0;
+    node_t* last;
+    node_t* first = buildBlock(arr, size, blocks, &last);
+    if (first == NULL) return 1;
+
+    while (*head != NULL) {         // Find the last link
+        head = &(*head)->next;
+        STAT_ADD(STAT_ENQUEUE, traversed, 1);
+    }
+    *head = first;
+    return 0;
+}
+
+// Prepends an array to the head of a linked list using one allocation.
+int prependArray(node_t** head, int arr[], int size, slab_t** blocks) {
+    STAT_OP(STAT_PUSH);
+    if (size <= 0) return 0;
+    node_t* last;
+    node_t* first = buildBlock(arr, size, blocks, &last);
+    if (first == NULL) return 1;
+
+    last->next = *head;
+    *head = first;
+    return 0;
+}
+
+// Appends an array to the tail of a list handle using one allocation.
+int listAppendArray(sllist_t* list, int arr[], int size, slab_t** blocks) {
+    STAT_OP(STAT_ENQUEUE);
+    if (size <= 0) return 0;
+    node_t* last;
+    node_t* first = buildBlock(arr, size, blocks, &last);
+    if (first == NULL) return 1;
+
+    if (list->tail == NULL) list->head = first;
+    else list->tail->next = first;
+    list->tail = last;
+    list->count += size;
+    return 0;
+}
+
+// Releases every block in a chain.
+void releaseBlocks(slab_t** blocks) {
+    while (*blocks != NULL) {
+        slab_t* delete = *blocks;
+        *blocks = delete->next;
+        free(delete);
+    }
+}
+
+// Returns 1 if node lies inside one of the blocks in the chain.
+static int inBlocks(const node_t* node, const slab_t* blocks) {
+    uintptr_t address = (uintptr_t)node;
+    for (; blocks != NULL; blocks = blocks->next) {
+        uintptr_t first = (uintptr_t)blocks->nodes;
+        if (address >= first && address < first + sizeof(node_t) * blocks->used) return 1;
+    }
+    return 0;
+}
+
+// Destroys a list of mixed individually allocated and block nodes.
+void destroyWithBlocks(node_t** head, slab_t** blocks) {
+    STAT_OP(STAT_DESTROY);
+    while (*head != NULL) {
+        node_t* delete = *head;
+        *head = delete->next;
+        if (!inBlocks(delete, *blocks)) free(delete);
+    }
+    releaseBlocks(blocks);
+}
+
+// Copies a list into a new block in traversal order, returning the block or NULL.
+static slab_t* copyToBlock(node_t* head) {
+    int size = countNodes(head);
+    slab_t* block = malloc(sizeof(slab_t) + sizeof(node_t) * size);
+    if (block == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in compaction\n");
+        return NULL;
+    }
+    block->used = size;
+    block->next = NULL;
+
+    node_t* nodes = block->nodes;
+    for (int i = 0; i < size; i++, head = head->next) {
+        nodes[i].data = head->data;
+        nodes[i].next = &nodes[i + 1];
+    }
+    nodes[size - 1].next = NULL;
+    return block;
+}
+
+// Copies a linked list into one contiguous block, freeing the old nodes.
+int compactList(node_t** head, slab_t** blocks) {
+    if (*head == NULL) return 0;
+
+    slab_t* block = copyToBlock(*head);
+    if (block == NULL) return 1;
+
+    node_t* old = *head;
+    while (old != NULL) {
+        node_t* delete = old;
+        old = old->next;
+        free(delete);
+    }
+    block->next = *blocks;
+    *blocks = block;
+    *head = block->nodes;
+    return 0;
+}
+
+// Compacts a linked list whose nodes all live in a block chain.
+int compactBlocks(node_t** head, slab_t** blocks) {
+    if (*head == NULL) return 0;
+
+    slab_t* block = copyToBlock(*head);
+    if (block == NULL) return 1;
+
+    releaseBlocks(blocks);
+    *blocks = block;
+    *head = block->nodes;
+    return 0;
+}
+
+// Measures the fraction of hops that stay within one cache line.
+double listLocality(node_t* head) {
+    if (head == NULL || head->next == NULL) return 1.0;
+
+    long hops = 0, local = 0;
+    for (; head->next != NULL; head = head->next) {
+        uintptr_t from = (uintptr_t)head;
+        uintptr_t to = (uintptr_t)head->next;
+        local += (to > from ? to - from : from - to) <= 64;    // Prefetchers follow either direction
+        hops++;
+    }
+    return (double)local / hops;
+}
+
+// Restores the heap property below slot i of a min-heap of list heads.
+static void siftDown(node_t* heap[], int size, int i) {
+    node_t* item = heap[i];
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= size) break;
+        if (child + 1 < size) {
+            STAT_ADD(STAT_SORT, comparisons, 1);
+            if (heap[child + 1]->data < heap[child]->data) child++;
+        }
+        STAT_ADD(STAT_SORT, comparisons, 1);
+        if (item->data <= heap[child]->data) break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = item;
+}
+
+// Merges k sorted linked lists into one using a binary heap of list heads.
+void mergeK(node_t** head, node_t* lists[], int k) {
+    STAT_OP(STAT_SORT);
+    // Drop empty lists, then heapify the remaining heads
+    int size = 0;
+    for (int i = 0; i < k; i++) {
+        if (lists[i] != NULL) lists[size++] = lists[i];
+    }
+    for (int i = size / 2 - 1; i >= 0; i--) siftDown(lists, size, i);
+
+    node_t dummy;
+    node_t* tail = &dummy;
+    while (size > 1) {
+        node_t* smallest = lists[0];
+        tail->next = smallest;
+        tail = smallest;
+        lists[0] = smallest->next;
+        if (lists[0] == NULL) lists[0] = lists[--size];     // List exhausted
+        siftDown(lists, size, 0);
+    }
+    tail->next = size ? lists[0] : NULL;    // The last list is already in order
+    *head = dummy.next;
+}
+
+// Unlinks and frees the head node of a list.
+static void dropHead(node_t** head) {
+    node_t* delete = *head;
+    *head = delete->next;
+    free(delete);
+}
+
+// Moves the head of list after tail unless it repeats the tail's value, returning the new tail.
+static node_t* appendDistinct(node_t* tail, node_t* dummy, node_t** list) {
+    if (tail != dummy && tail->data == (*list)->data) {
+        dropHead(list);
+        return tail;
+    }
+    tail->next = *list;
+    *list = (*list)->next;
+    return tail->next;
+}
+
+// Computes the union of two sorted linked lists in a single pass.
+void sortedUnion(node_t** head, node_t* left, node_t* right) {
+    STAT_OP(STAT_SORT);
+    node_t dummy;
+    node_t* tail = &dummy;
+    while (left || right) {
+        STAT_ADD(STAT_SORT, comparisons, left && right);
+        if (!right || (left && left->data <= right->data)) tail = appendDistinct(tail, &dummy, &left);
+        else tail = appendDistinct(tail, &dummy, &right);
+    }
+    tail->next = NULL;
+    *head = dummy.next;
+}
+
+// Computes the intersection of two sorted linked lists in a single pass.
+void sortedIntersection(node_t** head, node_t* left, node_t* right) {
+    STAT_OP(STAT_SORT);
+    node_t dummy;
+    node_t* tail = &dummy;
+    while (left && right) {
+        STAT_ADD(STAT_SORT, comparisons, 1);
+        if (left->data < right->data) dropHead(&left);
+        else if (left->data > right->data) dropHead(&right);
+        else {
+            tail = appendDistinct(tail, &dummy, &left);
+            dropHead(&right);
+        }
+    }
+    tail->next = NULL;
+    while (left) dropHead(&left);       // At most one of them is non-empty
+    while (right) dropHead(&right);
+    *head = dummy.next;
+}
+
+// Computes the difference of two sorted linked lists in a single pass.
+void sortedDifference(node_t** head, node_t* left, node_t* right) {
+    STAT_OP(STAT_SORT);
+    node_t dummy;
+    node_t* tail = &dummy;
+    while (left) {
+        STAT_ADD(STAT_SORT, comparisons, right != NULL);
+        if (right && right->data < left->data) dropHead(&right);
+        else if (right && right->data == left->data) dropHead(&left);  // Keep right for repeats
+        else tail = appendDistinct(tail, &dummy, &left);
+    }
+    tail->next = NULL;
+    while (right) dropHead(&right);
+    *head = dummy.next;
+}
+
+// Inserts a new node into a sorted linked list, after any equal values.
+int sortedInsert(node_t** head, int data) {
+    STAT_OP(STAT_PUSH);
+    node_t* new_node = malloc(sizeof(node_t));
+    if (new_node == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in sortedInsert\n");
+        return 1;
+    }
+    while (*head != NULL && (*head)->data <= data) {
+        STAT_ADD(STAT_PUSH, traversed, 1);
+        head = &(*head)->next;
+    }
+    new_node->data = data;
+    new_node->next = *head;
+    *head = new_node;
+    return 0;
+}
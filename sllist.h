@@ -5,6 +5,11 @@
  * @date 27th April 2023
 */
 
+#ifndef SLLIST_H
+#define SLLIST_H
+
+#include <stdio.h>
+
 /**
  * A struct representing a node in a linked list.
 */
@@ -13,6 +18,36 @@ typedef struct node {
     struct node* next;  /**< A pointer to the next node in the list*/
 } node_t;
 
+/**
+ * A struct representing a slab of contiguous nodes, owned by a node pool or
+ * by a block chain built with createfromArrayBlock() and friends.
+*/
+typedef struct slab {
+    struct slab* next;  /**< A pointer to the previously allocated slab */
+    int used;           /**< Number of nodes handed out from this slab */
+    node_t nodes[];     /**< Contiguous node storage */
+} slab_t;
+
+/**
+ * A struct representing a pool (arena) of nodes allocated in slabs.
+ * Released nodes are kept on an intrusive free list, linked through their next pointer.
+*/
+typedef struct nodepool {
+    slab_t* slabs;          /**< A pointer to the most recently allocated slab */
+    node_t* free_list;      /**< Released nodes available for reuse */
+    int slab_size;          /**< Number of nodes per slab */
+} nodepool_t;
+
+/**
+ * A struct representing a list handle that tracks the head, tail and length of a linked list.
+ * Handle functions keep all three fields consistent, giving O(1) enqueue and length.
+*/
+typedef struct sllist {
+    node_t* head;   /**< A pointer to the first node of the list */
+    node_t* tail;   /**< A pointer to the last node of the list */
+    int count;      /**< Number of nodes in the list */
+} sllist_t;
+
 /**
  * Creates a linked list based on input values
  * @param order A character denoting the order of list construction: 'r' for reverse
@@ -98,6 +133,57 @@ void reverseList(node_t** head);
 */
 void deleteDuplicates(node_t** head);
 
+/**
+ * @brief Deletes all duplicated nodes in a linked list in a single pass using a hash set.
+ * The first occurrence of each value is kept and the remaining nodes keep their order.
+ * Values seen so far are stored in a flat open-addressing table sized from the list length.
+ * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
+ * @return Returns 0 upon successful completion, 1 upon memory allocation failure (list unchanged).
+*/
+int deleteDuplicatesHash(node_t** head);
+
+/**
+ * A struct representing the open-addressing set of ints behind deleteDuplicatesHash(),
+ * for removing duplicates from other list types in linear time.
+*/
+typedef struct intset {
+    int* table;         /**< Power-of-two table of values; INT_MIN marks an empty slot */
+    size_t mask;        /**< Number of slots minus one */
+    int bits;           /**< log2 of the number of slots */
+    int has_min;        /**< Non-zero once INT_MIN has been added */
+} intset_t;
+
+/**
+ * @brief Creates an empty set with room for count values at a load factor of at most 0.5.
+ * @param set A pointer to the set.
+ * @param count The number of values that will be added.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure, or if
+ * the table for count values would not fit in memory.
+*/
+int intsetInit(intset_t* set, size_t count);
+
+/**
+ * @brief Adds a value to a set.
+ * @param set A pointer to the set.
+ * @param value The value to add.
+ * @return Returns 1 if the value was already in the set, 0 if it has been added.
+*/
+int intsetAdd(intset_t* set, int value);
+
+/**
+ * @brief Deallocates the table of a set.
+ * @param set A pointer to the set.
+*/
+void intsetDestroy(intset_t* set);
+
+/**
+ * @brief Deletes all duplicated nodes in a linked list that is sorted in ascending order.
+ * Duplicates of a sorted list are adjacent, so a single pass with no extra memory is enough.
+ * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
+ * @return Returns nothing.
+*/
+void deleteSortedDuplicates(node_t** head);
+
 /**
  * @brief Sorts a linked list in ascending order using merge sort algorithm
  * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
@@ -105,6 +191,64 @@ void deleteDuplicates(node_t** head);
 */
 void mergeSort(node_t** head);
 
+/**
+ * @brief Sorts a linked list in ascending order using an iterative bottom-up natural merge sort.
+ * The list is walked once, cutting it into already ascending runs that are merged like a
+ * binary counter, so no recursion or splitList() traversal is needed and merges stay
+ * cache-local. Presorted input is a single run and finishes in one O(n) pass.
+ * Equal elements keep their original relative order, as with mergeSort().
+ * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
+ * @return Returns nothing.
+*/
+void naturalMergeSort(node_t** head);
+
+/**
+ * @brief Sorts a linked list in ascending order using an LSD radix sort on 8-bit digits.
+ * Each pass distributes nodes into 256 bucket chains by one byte of the value and
+ * concatenates them, relinking the existing nodes without comparisons or allocation.
+ * Negative values are handled by flipping the sign bit, and byte positions that are
+ * equal across the whole list are skipped. The sort is stable.
+ * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
+ * @return Returns nothing.
+*/
+void radixSort(node_t** head);
+
+/**
+ * Lists of at least this many nodes are sorted by hybridSort() with arraySort().
+*/
+#ifndef HYBRID_SORT_THRESHOLD
+#define HYBRID_SORT_THRESHOLD 1024
+#endif
+
+/**
+ * Lists of at most this many nodes are sorted by arraySort() with an insertion sort.
+*/
+#ifndef ARRAY_SORT_INSERTION
+#define ARRAY_SORT_INSERTION 32
+#endif
+
+/**
+ * @brief Sorts a linked list in ascending order by sorting its values in a contiguous buffer.
+ * The values are copied into an array in one pass, sorted there with an LSD radix sort
+ * (an insertion sort for short lists) and written back in a second pass, so the sort itself
+ * never chases pointers. Nodes are not relinked: each keeps its place in the list and
+ * receives a new value, so pointers to individual nodes do not follow their values.
+ * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure (list unchanged).
+*/
+int arraySort(node_t** head);
+
+/**
+ * @brief Sorts a linked list in ascending order, choosing the algorithm by its length.
+ * Lists of HYBRID_SORT_THRESHOLD nodes or more use arraySort(), shorter ones (or any list
+ * when the buffer cannot be allocated) use naturalMergeSort(). The threshold is the
+ * crossover reported by bench --crossover. A list that is already in non-decreasing
+ * order is detected while its length is counted and left as it is.
+ * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
+ * @return Returns nothing.
+*/
+void hybridSort(node_t** head);
+
 /**
  * @brief A helper function that merges two sorted linked lists into a single sorted linked list.
  * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
@@ -157,6 +301,33 @@ int length(node_t* head);
  */
 void savetoFile(node_t* head, char* filename);
 
+/**
+ * Option flags for savetoFileFast().
+*/
+#define SAVE_FSYNC  1   /**< fsync the file (and its directory when atomic) before returning */
+#define SAVE_ATOMIC 2   /**< Write to a temporary file in the same directory, then rename over filename */
+
+/**
+ * Error codes returned by savetoFileFast().
+*/
+#define SAVE_OK         0   /**< Success */
+#define SAVE_EMPTY      1   /**< The list is empty */
+#define SAVE_OPEN_ERR   2   /**< The output (or temporary) file could not be created */
+#define SAVE_WRITE_ERR  3   /**< A write, fsync or close failed */
+#define SAVE_RENAME_ERR 4   /**< The temporary file could not be renamed over filename */
+
+/**
+ * @brief Saves the content of a singly linked list to a file, one element per line.
+ * Produces the same output as savetoFile(), but formats ints with a table based
+ * itoa into a large buffer that is flushed with a few write(2) calls.
+ * @param head The head pointer of the singly linked list.
+ * @param filename The name of the file to save the content to.
+ * @param flags Zero or more of SAVE_FSYNC and SAVE_ATOMIC, combined with |.
+ * @return SAVE_OK upon successful completion, otherwise one of the SAVE_*_ERR codes or SAVE_EMPTY.
+ * On failure with SAVE_ATOMIC, the original file is left untouched.
+ */
+int savetoFileFast(node_t* head, char* filename, int flags);
+
 /**
  * @brief Creates a singly linked list from the content of a file.
  * The function reads the content of the specified file, line by line, and
@@ -168,6 +339,57 @@ void savetoFile(node_t* head, char* filename);
  */
 node_t* createfromFile(char* input);
 
+/**
+ * @brief Creates a singly linked list from a text stream in a single pass.
+ * The stream is read in large blocks and parsed with a hand-written scanner, appending
+ * each value to the tail as it goes, so pipes and stdin are supported (e.g. `cat data | app`).
+ * Values are separated by whitespace; tokens that are not valid ints are skipped.
+ * @param stream The stream to read from, e.g. stdin. It is not closed.
+ * @return A pointer to the head of the created list, or NULL if nothing valid was read or on error.
+ */
+node_t* createfromStream(FILE* stream);
+
+/**
+ * @brief Creates a singly linked list from a text file descriptor in a single pass.
+ * Behaves like createfromStream() but reads with read(2), bypassing stdio buffering.
+ * @param fd The file descriptor to read from, e.g. 0 for stdin. It is not closed.
+ * @return A pointer to the head of the created list, or NULL if nothing valid was read or on error.
+ */
+node_t* createfromFd(int fd);
+
+/**
+ * @brief Reads whitespace-separated ints from a text stream, passing each valid one to a callback.
+ * This is the scanner behind createfromStream(), for loading into other containers:
+ * tokens that are not valid ints are skipped whole.
+ * @param stream The stream to read from.
+ * @param emit Called with ctx and each value in order; a non-zero return stops the scan.
+ * @param ctx Passed through to emit.
+ * @return Returns 0 upon successful completion. 1 on a read error, memory allocation failure
+ * or if emit returned non-zero; values passed to emit before that are kept by the caller.
+ */
+int scanStream(FILE* stream, int (*emit)(void* ctx, int value), void* ctx);
+
+/**
+ * @brief Saves the content of a singly linked list to a binary file.
+ * The file starts with a 24-byte header (magic "SLLB", format version, 64-bit element
+ * count and a checksum of the payload), followed by the packed 32-bit ints in list
+ * order, in host byte order.
+ * @param head The head pointer of the singly linked list.
+ * @param filename The name of the file to save the content to.
+ * @return Returns 0 upon successful completion, 1 if the list is empty or the file cannot be written.
+ */
+int savetoBinary(node_t* head, char* filename);
+
+/**
+ * @brief Creates a singly linked list from a binary file written by savetoBinary().
+ * The file is memory mapped and the list is built in one forward pass directly
+ * from the mapped payload, without intermediate buffers.
+ * @param input The name of the file to read the content from.
+ * @return A pointer to the head of the created list, or NULL if the file cannot be read,
+ * is not a valid list file, fails the checksum or is empty.
+ */
+node_t* createfromBinary(char* input);
+
 /**
  * @brief Recursively counts the number of occurrences of a specific value in a linked list.
  * @param head Pointer to the head of the linked list.
@@ -209,8 +431,20 @@ int count_old(node_t** head, int value);
  */
 int length_old(node_t** head);
 
+/**
+ * @brief Seeds the generator behind randomUnique(), randomArray() and shuffle().
+ * Each thread has its own generator. Until a thread calls this, its generator is seeded
+ * from rand() on first use, so srand() selects the data as before and a program that
+ * never seeds gets the same data on every run. Seeds drawn by other threads depend on
+ * the order of their first calls; call randomSeed() in each thread for reproducible
+ * multi-threaded inputs. See rng.h for explicit generators.
+ * @param seed The seed.
+ */
+void randomSeed(unsigned long long seed);
+
 /**
  * @brief Fill an array of integers with unique numbers ranging from 0 to size - 1.
+ * Draws from the calling thread's generator, seeded by randomSeed() or else from rand().
  * @param arr The array to be filled with unique numbers.
  * @param size The size of the array.
  */
@@ -218,6 +452,8 @@ void randomUnique(int arr[], int size);
 
 /**
  * @brief Fill an array of integers with random numbers ranging from min to max.
+ * Draws from the calling thread's generator, seeded by randomSeed() or else from rand().
+ * Values are unbiased for any range, including INT_MIN to INT_MAX.
  * @param arr The array to be filled with random numbers.
  * @param size The size of the array.
  * @param min The minimum value of the random numbers.
@@ -227,7 +463,297 @@ void randomArray(int arr[], int size, int min, int max);
 
 /**
  * @brief Shuffle the elements of an integer array.
+ * Draws from the calling thread's generator, seeded by randomSeed() or else from rand().
  * @param arr The array to be shuffled.
  * @param size The size of the array.
  */
-void shuffle(int arr[], int size);
\ No newline at end of file
+void shuffle(int arr[], int size);
+
+/**
+ * @brief Creates a node pool that allocates nodes in slabs.
+ * @param slab_size The number of nodes per slab. If 0 or less, a default of 1024 is used.
+ * @return A pointer to the created pool, or NULL upon memory allocation failure.
+ */
+nodepool_t* createPool(int slab_size);
+
+/**
+ * @brief Allocates a node from a node pool.
+ * Nodes on the free list are reused first, otherwise the node is taken from the current slab.
+ * A new slab is allocated only when the current one is exhausted.
+ * @param pool A pointer to the node pool.
+ * @return A pointer to the uninitialised node, or NULL upon memory allocation failure.
+ */
+node_t* poolAlloc(nodepool_t* pool);
+
+/**
+ * @brief Returns a node to the free list of the pool it was allocated from.
+ * @param pool A pointer to the node pool.
+ * @param node A pointer to the node to be released.
+ */
+void poolFree(nodepool_t* pool, node_t* node);
+
+/**
+ * @brief Destroys a node pool, releasing every slab at once.
+ * All lists built from the pool become invalid. Cost is proportional to the number of slabs.
+ * @param pool A pointer to the node pool. Passed by reference (e.g. &pool).
+ */
+void destroyPool(nodepool_t** pool);
+
+/**
+ * @brief Adds a node allocated from a pool to the head of a linked list.
+ * Pool nodes must not be freed by pop(), destroy(), deleteMatch() or other functions that
+ * call free(); use poolPop(), poolDestroyList() or destroyPool().
+ * @param pool A pointer to the node pool.
+ * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
+ * @param data An integer data to be stored in the new node.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int poolPush(nodepool_t* pool, node_t** head, int data);
+
+/**
+ * @brief Adds a node allocated from a pool to the tail of a linked list.
+ * Pool nodes must not be freed by pop(), destroy(), deleteMatch() or other functions that
+ * call free(); use poolPop(), poolDestroyList() or destroyPool().
+ * @param pool A pointer to the node pool.
+ * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
+ * @param data An integer data to be stored in the new node.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int poolEnqueue(nodepool_t* pool, node_t** head, int data);
+
+/**
+ * @brief Removes a node from the head of a linked list and returns it to the pool.
+ * @param pool A pointer to the node pool the list was built from.
+ * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
+ * @return 0 upon successful completion, 1 otherwise
+ */
+int poolPop(nodepool_t* pool, node_t** head);
+
+/**
+ * @brief Create a linked list from an array using nodes allocated from a pool.
+ * Pool nodes must not be freed by pop(), destroy(), deleteMatch() or other functions that
+ * call free(); use poolPop(), poolDestroyList() or destroyPool().
+ * @param pool A pointer to the node pool.
+ * @param arr An integer array containing the data to be added to the linked list
+ * @param size An integer representing the size of the array and linked list to be created
+ * @return Returns a pointer to the head of created linked list or NULL if error
+ */
+node_t* createfromArrayPool(nodepool_t* pool, int arr[], int size);
+
+/**
+ * @brief Returns every node of a linked list to the pool's free list.
+ * Use destroyPool() instead to release all lists built from the pool at once.
+ * @param pool A pointer to the node pool the list was built from.
+ * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
+ */
+void poolDestroyList(nodepool_t* pool, node_t** head);
+
+/**
+ * @brief Initialises a list handle to an empty list.
+ * @param list A pointer to the list handle.
+ */
+void initList(sllist_t* list);
+
+/**
+ * @brief Adds a node to the head of a list handle.
+ * @param list A pointer to the list handle.
+ * @param data An integer data to be stored in the new node.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int listPush(sllist_t* list, int data);
+
+/**
+ * @brief Adds a node to the tail of a list handle in constant time.
+ * @param list A pointer to the list handle.
+ * @param data An integer data to be stored in the new node.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int listEnqueue(sllist_t* list, int data);
+
+/**
+ * @brief Removes a node from the head of a list handle.
+ * @param list A pointer to the list handle.
+ * @return 0 upon successful completion, 1 otherwise
+ */
+int listPop(sllist_t* list);
+
+/**
+ * @brief Returns the number of elements in a list handle in constant time.
+ * @param list A pointer to the list handle.
+ * @return An integer representing the number of elements in the list.
+ */
+int listLength(sllist_t* list);
+
+/**
+ * @brief Deletes all nodes with a matching value from a list handle.
+ * @param list A pointer to the list handle.
+ * @param value The value to be deleted from the list.
+ */
+void listDeleteMatch(sllist_t* list, int value);
+
+/**
+ * @brief Reverses the order of a list handle.
+ * @param list A pointer to the list handle.
+ */
+void listReverse(sllist_t* list);
+
+/**
+ * @brief Sorts a list handle in ascending order using merge sort.
+ * @param list A pointer to the list handle.
+ */
+void listSort(sllist_t* list);
+
+/**
+ * @brief Destroys a list handle, deallocating all nodes and resetting it to empty.
+ * @param list A pointer to the list handle.
+ */
+void listDestroy(sllist_t* list);
+
+/**
+ * @brief Creates a linked list from an array using one contiguous allocation.
+ * All nodes are allocated as a single block and linked in order in one forward pass.
+ * The block is added to a chain of release handles; nodes in it must not be freed
+ * individually (by pop(), destroy() etc.) and are released with releaseBlocks().
+ * @param arr An integer array containing the data to be added to the linked list
+ * @param size An integer representing the size of the array and linked list to be created
+ * @param blocks A pointer to the block chain, initially NULL. Passed by reference (e.g. &blocks).
+ * @return Returns a pointer to the head of created linked list or NULL if empty or error
+ */
+node_t* createfromArrayBlock(int arr[], int size, slab_t** blocks);
+
+/**
+ * @brief Appends the elements of an array to the tail of a linked list using one allocation.
+ * The existing list is walked once to find its tail; use listAppendArray() to avoid that.
+ * If the list was built with push() or similar, it now mixes individually allocated and
+ * block nodes: free it with destroyWithBlocks(), not destroy() or releaseBlocks() alone.
+ * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
+ * @param arr An integer array containing the data to be appended.
+ * @param size An integer representing the size of the array.
+ * @param blocks A pointer to the block chain that receives the new block.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int appendArray(node_t** head, int arr[], int size, slab_t** blocks);
+
+/**
+ * @brief Prepends the elements of an array to the head of a linked list using one allocation.
+ * The array order is kept, so arr[0] becomes the new head.
+ * If the list was built with push() or similar, it now mixes individually allocated and
+ * block nodes: free it with destroyWithBlocks(), not destroy() or releaseBlocks() alone.
+ * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
+ * @param arr An integer array containing the data to be prepended.
+ * @param size An integer representing the size of the array.
+ * @param blocks A pointer to the block chain that receives the new block.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int prependArray(node_t** head, int arr[], int size, slab_t** blocks);
+
+/**
+ * @brief Appends the elements of an array to the tail of a list handle using one allocation.
+ * Nodes added this way must be released with releaseBlocks(), not listPop() or listDestroy().
+ * @param list A pointer to the list handle.
+ * @param arr An integer array containing the data to be appended.
+ * @param size An integer representing the size of the array.
+ * @param blocks A pointer to the block chain that receives the new block.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int listAppendArray(sllist_t* list, int arr[], int size, slab_t** blocks);
+
+/**
+ * @brief Releases every block in a chain, freeing all nodes built from it at once.
+ * @param blocks A pointer to the block chain. Passed by reference (e.g. &blocks).
+ */
+void releaseBlocks(slab_t** blocks);
+
+/**
+ * @brief Destroys a list mixing individually allocated nodes and nodes from a block chain.
+ * Nodes outside every block are freed one by one, then the whole chain is released.
+ * Each node is checked against each block, so cost is O(n * number of blocks).
+ * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
+ * @param blocks A pointer to the block chain the list's block nodes came from.
+ */
+void destroyWithBlocks(node_t** head, slab_t** blocks);
+
+/**
+ * @brief Copies a linked list into one contiguous block in traversal order.
+ * After sorting, reversing or deleting, nodes are scattered through the heap and each hop
+ * is likely a cache miss. Compaction relinearises them so traversal becomes sequential.
+ * The old nodes must have been allocated individually (push(), createfromArray(), ...)
+ * and are freed. The new block is added to the block chain and is released with releaseBlocks().
+ * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
+ * @param blocks A pointer to the block chain that receives the new block.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure (list unchanged).
+ */
+int compactList(node_t** head, slab_t** blocks);
+
+/**
+ * @brief Compacts a linked list whose nodes all live in a block chain.
+ * Like compactList(), but the old nodes are released by freeing the old chain,
+ * which is replaced by the single new block.
+ * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
+ * @param blocks A pointer to the block chain owning every node of the list.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure (list unchanged).
+ */
+int compactBlocks(node_t** head, slab_t** blocks);
+
+/**
+ * @brief Measures how sequential a linked list is in memory.
+ * A hop is counted as local when the next node starts at most 64 bytes (one cache line)
+ * before or after the current one. A freshly compacted list scores 1.0; values well below that
+ * mean traversal is dominated by cache misses and compaction is likely to pay off.
+ * @param head A pointer to the head node of the linked list.
+ * @return The fraction of local hops between 0.0 and 1.0, or 1.0 for lists shorter than 2.
+ */
+double listLocality(node_t* head);
+
+/**
+ * @brief Merges k sorted linked lists into one using a binary heap of list heads.
+ * Runs in O(n log k) and relinks the nodes in place. Equal values from different lists
+ * may come out in any order.
+ * @param head A pointer to the head of the merged list. Passed by reference (e.g. &list).
+ * @param lists An array of k sorted lists, which may be NULL. The array is reused as the heap
+ * and its contents are undefined afterwards.
+ * @param k The number of lists.
+ * @return Returns nothing.
+*/
+void mergeK(node_t** head, node_t* lists[], int k);
+
+/**
+ * @brief Computes the union of two sorted linked lists in a single pass.
+ * The result holds every value found in either list once; the surplus nodes are freed.
+ * @param head A pointer to the head of the resulting list. Passed by reference (e.g. &list).
+ * @param left A pointer to the head of the first sorted linked list.
+ * @param right A pointer to the head of the second sorted linked list.
+ * @return Returns nothing.
+*/
+void sortedUnion(node_t** head, node_t* left, node_t* right);
+
+/**
+ * @brief Computes the intersection of two sorted linked lists in a single pass.
+ * The result holds every value found in both lists once, reusing nodes of left;
+ * all other nodes are freed.
+ * @param head A pointer to the head of the resulting list. Passed by reference (e.g. &list).
+ * @param left A pointer to the head of the first sorted linked list.
+ * @param right A pointer to the head of the second sorted linked list.
+ * @return Returns nothing.
+*/
+void sortedIntersection(node_t** head, node_t* left, node_t* right);
+
+/**
+ * @brief Computes the difference of two sorted linked lists in a single pass.
+ * The result holds every value of left that is not in right once; all other nodes are freed.
+ * @param head A pointer to the head of the resulting list. Passed by reference (e.g. &list).
+ * @param left A pointer to the head of the sorted linked list to subtract from.
+ * @param right A pointer to the head of the sorted linked list of values to remove.
+ * @return Returns nothing.
+*/
+void sortedDifference(node_t** head, node_t* left, node_t* right);
+
+/**
+ * @brief Inserts a new node into a linked list sorted in ascending order, after any equal values.
+ * @param head A pointer to the head of the linked list. Passed by reference (e.g. &list).
+ * @param data An integer data to be inserted.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+*/
+int sortedInsert(node_t** head, int data);
+
+#endif /* SLLIST_H */
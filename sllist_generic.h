@@ -0,0 +1,223 @@
+/**
+ * Type-generic singly linked lists via macro-generated specializations
+ * @file sllist_generic.h
+ *
+ * SLLIST_DEFINE(name, T, cmp) emits a node type name_node_t storing a T inline
+ * and a full set of static inline functions prefixed with name_. The comparator
+ * cmp(a, b) takes two T values and returns <0, 0 or >0; it may be a macro or a
+ * static inline function, so comparisons inline at compile time with no void*
+ * payloads or function pointers. SLLIST_CMP suits any arithmetic type.
+ *
+ * Example:
+ *     SLLIST_DEFINE(idlist, long long, SLLIST_CMP)
+ *     idlist_node_t* ids = NULL;
+ *     idlist_push(&ids, 42LL);
+ *     idlist_sort(&ids);
+ *
+ * Generated functions mirror sllist.h: push, enqueue, pop, length, count,
+ * deleteMatch, reverse, merge, sort, destroy, save and load. save/load use a
+ * binary format: a header holding sizeof(T) and the element count, followed
+ * by the raw T values, so T must not contain pointers.
+*/
+
+#ifndef SLLIST_GENERIC_H
+#define SLLIST_GENERIC_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/** Three-way comparison for arithmetic types. */
+#define SLLIST_CMP(a, b) (((a) > (b)) - ((a) < (b)))
+
+#define SLLIST_DEFINE(name, T, cmp)                                                     \
+                                                                                        \
+typedef struct name##_node {                                                            \
+    T data;                         /* Payload stored inline */                         \
+    struct name##_node* next;                                                           \
+} name##_node_t;                                                                        \
+                                                                                        \
+/* Adds a node to the head of a list. Returns 0, or 1 on allocation failure. */         \
+static inline int name##_push(name##_node_t** head, T data) {                           \
+    name##_node_t* new_node = malloc(sizeof(name##_node_t));                            \
+    if (new_node == NULL) {                                                             \
+        fprintf(stderr, "Error: Memory allocation failed in " #name "_push\n");         \
+        return 1;                                                                       \
+    }                                                                                   \
+    new_node->data = data;                                                              \
+    new_node->next = *head;                                                             \
+    *head = new_node;                                                                   \
+    return 0;                                                                           \
+}                                                                                       \
+                                                                                        \
+/* Adds a node to the tail of a list. Returns 0, or 1 on allocation failure. */         \
+static inline int name##_enqueue(name##_node_t** head, T data) {                        \
+    name##_node_t* new_node = malloc(sizeof(name##_node_t));                            \
+    if (new_node == NULL) {                                                             \
+        fprintf(stderr, "Error: Memory allocation failed in " #name "_enqueue\n");      \
+        return 1;                                                                       \
+    }                                                                                   \
+    new_node->data = data;                                                              \
+    new_node->next = NULL;                                                              \
+    while (*head != NULL) head = &(*head)->next;                                        \
+    *head = new_node;                                                                   \
+    return 0;                                                                           \
+}                                                                                       \
+                                                                                        \
+/* Removes the head node, storing its payload in out if not NULL. Returns 0, or 1 */    \
+/* if the list is empty. */                                                             \
+static inline int name##_pop(name##_node_t** head, T* out) {                            \
+    if (*head == NULL) {                                                                \
+        fprintf(stderr, "Error: Cannot pop empty list.\n");                             \
+        return 1;                                                                       \
+    }                                                                                   \
+    name##_node_t* delete = *head;                                                      \
+    if (out != NULL) *out = delete->data;                                               \
+    *head = delete->next;                                                               \
+    free(delete);                                                                       \
+    return 0;                                                                           \
+}                                                                                       \
+                                                                                        \
+/* Counts the number of nodes in a list. */                                             \
+static inline int name##_length(name##_node_t* head) {                                  \
+    int i = 0;                                                                          \
+    for (; head != NULL; head = head->next) i++;                                        \
+    return i;                                                                           \
+}                                                                                       \
+                                                                                        \
+/* Counts the nodes comparing equal to value. */                                        \
+static inline int name##_count(name##_node_t* head, T value) {                          \
+    int i = 0;                                                                          \
+    for (; head != NULL; head = head->next) i += cmp(head->data, value) == 0;           \
+    return i;                                                                           \
+}                                                                                       \
+                                                                                        \
+/* Deletes all nodes comparing equal to value. */                                       \
+static inline void name##_deleteMatch(name##_node_t** head, T value) {                  \
+    while (*head != NULL) {                                                             \
+        if (cmp((*head)->data, value) == 0) {                                           \
+            name##_node_t* delete = *head;                                              \
+            *head = delete->next;                                                       \
+            free(delete);                                                               \
+        }                                                                               \
+        else head = &(*head)->next;                                                     \
+    }                                                                                   \
+}                                                                                       \
+                                                                                        \
+/* Reverses the order of a list. */                                                     \
+static inline void name##_reverse(name##_node_t** head) {                               \
+    name##_node_t* ptr = *head;                                                         \
+    name##_node_t* prv = NULL;                                                          \
+    while (ptr != NULL) {                                                               \
+        name##_node_t* next = ptr->next;                                                \
+        ptr->next = prv;                                                                \
+        prv = ptr;                                                                      \
+        ptr = next;                                                                     \
+    }                                                                                   \
+    *head = prv;                                                                        \
+}                                                                                       \
+                                                                                        \
+/* Merges two sorted lists, taking from left on ties (stable). */                       \
+static inline void name##_merge(name##_node_t** head, name##_node_t* left,              \
+                                name##_node_t* right) {                                 \
+    name##_node_t dummy;                                                                \
+    name##_node_t* tail = &dummy;                                                       \
+    while (left && right) {                                                             \
+        if (cmp(left->data, right->data) <= 0) {                                        \
+            tail->next = left;                                                          \
+            left = left->next;                                                          \
+        }                                                                               \
+        else {                                                                          \
+            tail->next = right;                                                         \
+            right = right->next;                                                        \
+        }                                                                               \
+        tail = tail->next;                                                              \
+    }                                                                                   \
+    tail->next = left ? left : right;                                                   \
+    *head = dummy.next;                                                                 \
+}                                                                                       \
+                                                                                        \
+/* Stable ascending sort: natural runs merged bottom-up like naturalMergeSort(). */     \
+static inline void name##_sort(name##_node_t** head) {                                  \
+    name##_node_t* bins[64] = { NULL };                                                 \
+    int used = 0;                                                                       \
+    name##_node_t* rest = *head;                                                        \
+    while (rest != NULL) {                                                              \
+        name##_node_t* run = rest;                                                      \
+        while (rest->next && cmp(rest->data, rest->next->data) <= 0) rest = rest->next; \
+        name##_node_t* run_tail = rest;                                                 \
+        rest = rest->next;                                                              \
+        run_tail->next = NULL;                                                          \
+        int k = 0;                                                                      \
+        for (; k < used && bins[k] != NULL; k++) {                                      \
+            name##_merge(&run, bins[k], run);                                           \
+            bins[k] = NULL;                                                             \
+        }                                                                               \
+        if (k == used) used++;                                                          \
+        bins[k] = run;                                                                  \
+    }                                                                                   \
+    name##_node_t* result = NULL;                                                       \
+    for (int k = 0; k < used; k++) {                                                    \
+        if (bins[k] != NULL) name##_merge(&result, bins[k], result);                    \
+    }                                                                                   \
+    *head = result;                                                                     \
+}                                                                                       \
+                                                                                        \
+/* Deallocates all nodes and sets the head to NULL. */                                  \
+static inline void name##_destroy(name##_node_t** head) {                               \
+    while (*head != NULL) {                                                             \
+        name##_node_t* delete = *head;                                                  \
+        *head = delete->next;                                                           \
+        free(delete);                                                                   \
+    }                                                                                   \
+}                                                                                       \
+                                                                                        \
+/* Saves a list to a binary file. Returns 0, or 1 if it cannot be written. */          \
+static inline int name##_save(name##_node_t* head, const char* filename) {              \
+    FILE* output = fopen(filename, "wb");                                               \
+    if (output == NULL) {                                                               \
+        fprintf(stderr, "Error: Unable to open file for writing.\n");                   \
+        return 1;                                                                       \
+    }                                                                                   \
+    unsigned long long header[2] = { sizeof(T), (unsigned long long)name##_length(head) }; \
+    int error = fwrite(header, sizeof(header), 1, output) != 1;                         \
+    for (; head != NULL && !error; head = head->next) {                                 \
+        error = fwrite(&head->data, sizeof(T), 1, output) != 1;                         \
+    }                                                                                   \
+    if (fclose(output) != 0) error = 1;                                                 \
+    if (error) fprintf(stderr, "Error: Failed to write list file.\n");                  \
+    return error;                                                                       \
+}                                                                                       \
+                                                                                        \
+/* Loads a list saved by name_save(). Returns NULL on error or for an empty list. */    \
+static inline name##_node_t* name##_load(const char* filename) {                        \
+    FILE* input = fopen(filename, "rb");                                                \
+    if (input == NULL) {                                                                \
+        fprintf(stderr, "Error: Unable to open file.\n");                               \
+        return NULL;                                                                    \
+    }                                                                                   \
+    unsigned long long header[2];                                                       \
+    name##_node_t* head = NULL;                                                         \
+    name##_node_t** link = &head;                                                       \
+    if (fread(header, sizeof(header), 1, input) != 1 || header[0] != sizeof(T)) {       \
+        fprintf(stderr, "Error: Not a " #name " list file.\n");                         \
+        fclose(input);                                                                  \
+        return NULL;                                                                    \
+    }                                                                                   \
+    for (unsigned long long i = 0; i < header[1]; i++) {                                \
+        name##_node_t* new_node = malloc(sizeof(name##_node_t));                        \
+        if (new_node == NULL || fread(&new_node->data, sizeof(T), 1, input) != 1) {     \
+            fprintf(stderr, "Error: Failed to read list file.\n");                      \
+            free(new_node);                                                             \
+            *link = NULL;                                                               \
+            name##_destroy(&head);                                                      \
+            break;                                                                      \
+        }                                                                               \
+        *link = new_node;                                                               \
+        link = &new_node->next;                                                         \
+    }                                                                                   \
+    if (head != NULL) *link = NULL;                                                     \
+    fclose(input);                                                                      \
+    return head;                                                                        \
+}
+
+#endif /* SLLIST_GENERIC_H */
@@ -0,0 +1,111 @@
+/**
+ * Operation counters and allocation instrumentation
+ * @file stats.c
+*/
+
+#include <stdlib.h>
+#include <stdatomic.h>
+#include "stats.h"
+
+#define FIELDS (sizeof(opstats_t) / sizeof(unsigned long long))
+
+static _Atomic unsigned long long counters[STAT_OPS][FIELDS];
+static _Thread_local statop_t current = STAT_OTHER;    // Innermost operation on this thread
+
+static const char* names[STAT_OPS] = {
+    "other", "push", "enqueue", "pop", "removeTail", "deleteMatch", "deleteDuplicates",
+    "reverseList", "sort", "count", "length", "destroy", "save", "load"
+};
+
+// Reports whether the library was built with instrumentation.
+int statsEnabled(void) {
+#ifdef SLLIST_STATS
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+// Adds n to one counter; field is the byte offset of an opstats_t member.
+void statAdd(statop_t op, size_t field, unsigned long long n) {
+    atomic_fetch_add_explicit(&counters[op][field / sizeof(unsigned long long)], n,
+                              memory_order_relaxed);
+}
+
+// Enters an operation, returning the one it interrupts. A call from inside the
+// same operation (e.g. listPush() calling push()) is not counted again.
+statop_t statEnter(statop_t op) {
+    statop_t saved = current;
+    current = op;
+    if (saved != op) statAdd(op, offsetof(opstats_t, calls), 1);
+    return saved;
+}
+
+// Leaves an operation, restoring the interrupted one.
+void statLeave(statop_t* saved) {
+    current = *saved;
+}
+
+// Counting malloc, attributed to the current operation.
+void* statMalloc(size_t size) {
+    statAdd(current, offsetof(opstats_t, mallocs), 1);
+    return malloc(size);
+}
+
+// Counting free, attributed to the current operation.
+void statFree(void* ptr) {
+    if (ptr == NULL) return;
+    statAdd(current, offsetof(opstats_t, frees), 1);
+    free(ptr);
+}
+
+// Copies the current counters of every operation.
+void statsSnapshot(opstats_t out[STAT_OPS]) {
+    for (int op = 0; op < STAT_OPS; op++) {
+        unsigned long long* fields = (unsigned long long*)&out[op];
+        for (size_t f = 0; f < FIELDS; f++) {
+            fields[f] = atomic_load_explicit(&counters[op][f], memory_order_relaxed);
+        }
+    }
+}
+
+// Resets every counter to zero.
+void statsReset(void) {
+    for (int op = 0; op < STAT_OPS; op++) {
+        for (size_t f = 0; f < FIELDS; f++) {
+            atomic_store_explicit(&counters[op][f], 0, memory_order_relaxed);
+        }
+    }
+}
+
+// Returns the name of an operation.
+const char* statsName(statop_t op) {
+    return op < STAT_OPS ? names[op] : "unknown";
+}
+
+// Prints the non-zero counters of every operation as a table.
+void statsDump(FILE* stream) {
+    opstats_t stats[STAT_OPS];
+    statsSnapshot(stats);
+
+    fprintf(stream, "%-18s %12s %12s %12s %14s %14s %14s %14s\n", "operation", "calls",
+            "mallocs", "frees", "traversed", "comparisons", "bytes_written", "bytes_read");
+    for (int op = 0; op < STAT_OPS; op++) {
+        opstats_t* s = &stats[op];
+        if (!(s->calls | s->mallocs | s->frees | s->traversed)) continue;
+        fprintf(stream, "%-18s %12llu %12llu %12llu %14llu %14llu %14llu %14llu\n", names[op],
+                s->calls, s->mallocs, s->frees, s->traversed, s->comparisons,
+                s->bytes_written, s->bytes_read);
+    }
+}
+
+// atexit handler for statsDumpAtExit.
+static void dumpAtExit(void) {
+    statsDump(stderr);
+}
+
+// Arranges for statsDump(stderr) to run when the program exits.
+void statsDumpAtExit(void) {
+    static atomic_flag registered = ATOMIC_FLAG_INIT;
+    if (!atomic_flag_test_and_set(&registered)) atexit(dumpAtExit);
+}
@@ -0,0 +1,114 @@
+/**
+ * Operation counters and allocation instrumentation
+ * @file stats.h
+ * Instrumentation is compiled out by default. Build the library with
+ * -DSLLIST_STATS to record, per operation, the number of calls, malloc/free
+ * calls, nodes traversed, comparisons and bytes written or read. Without it
+ * the API below still links, statsEnabled() returns 0 and snapshots are zero.
+ *
+ * Allocations are attributed to the innermost instrumented operation running
+ * on the calling thread (e.g. the mallocs of createfromArray() show up under
+ * push), and anything outside one is recorded under STAT_OTHER. Calls are
+ * counted once per entry from the caller: an operation that runs inside the
+ * same operation, such as push() inside listPush(), adds no further call.
+*/
+
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+/**
+ * Operations that counters are recorded for.
+*/
+typedef enum statop {
+    STAT_OTHER,             /**< Anything not covered below */
+    STAT_PUSH,              /**< push(), listPush(), poolPush(), sortedInsert() */
+    STAT_ENQUEUE,           /**< enqueue(), listEnqueue(), poolEnqueue() */
+    STAT_POP,               /**< pop(), listPop(), poolPop() */
+    STAT_REMOVE_TAIL,       /**< removeTail() */
+    STAT_DELETE_MATCH,      /**< deleteMatch(), listDeleteMatch() */
+    STAT_DELETE_DUPLICATES, /**< deleteDuplicates() and its variants */
+    STAT_REVERSE,           /**< reverseList() */
+    STAT_SORT,              /**< mergeSort(), merge(), splitList(), the other sorts and set operations */
+    STAT_COUNT,             /**< count() */
+    STAT_LENGTH,            /**< length() */
+    STAT_DESTROY,           /**< destroy(), listDestroy() */
+    STAT_SAVE,              /**< savetoFile() and its variants */
+    STAT_LOAD,              /**< createfromFile() and its variants */
+    STAT_OPS                /**< Number of operations */
+} statop_t;
+
+/**
+ * A struct holding the counters recorded for one operation.
+*/
+typedef struct opstats {
+    unsigned long long calls;           /**< Number of calls */
+    unsigned long long mallocs;         /**< malloc calls */
+    unsigned long long frees;           /**< free calls */
+    unsigned long long traversed;       /**< Nodes visited while walking lists */
+    unsigned long long comparisons;     /**< Value comparisons in merges and duplicate removal */
+    unsigned long long bytes_written;   /**< Bytes written to files */
+    unsigned long long bytes_read;      /**< Bytes read or scanned from files */
+} opstats_t;
+
+/**
+ * @brief Reports whether the library was built with instrumentation.
+ * @return 1 if built with SLLIST_STATS, 0 otherwise.
+ */
+int statsEnabled(void);
+
+/**
+ * @brief Copies the current counters of every operation.
+ * @param out An array of STAT_OPS entries, indexed by statop_t.
+ */
+void statsSnapshot(opstats_t out[STAT_OPS]);
+
+/**
+ * @brief Resets every counter to zero.
+ */
+void statsReset(void);
+
+/**
+ * @brief Returns the name of an operation, e.g. "enqueue".
+ * @param op The operation.
+ * @return A static string.
+ */
+const char* statsName(statop_t op);
+
+/**
+ * @brief Prints the non-zero counters of every operation as a table.
+ * @param stream The stream to print to, e.g. stderr.
+ */
+void statsDump(FILE* stream);
+
+/**
+ * @brief Arranges for statsDump(stderr) to run when the program exits.
+ * Calling it more than once has no further effect.
+ */
+void statsDumpAtExit(void);
+
+/* Internal hooks used by the instrumented library sources. */
+void statAdd(statop_t op, size_t field, unsigned long long n);
+statop_t statEnter(statop_t op);
+void statLeave(statop_t* saved);
+void* statMalloc(size_t size);
+void statFree(void* ptr);
+
+#ifdef SLLIST_STATS
+/**
+ * Marks the enclosing function as operation op until it returns: counts the
+ * call and attributes allocations inside it to op. Uses the GCC/Clang cleanup
+ * attribute to restore the previous operation on every return path.
+*/
+#define STAT_OP(op) \
+    statop_t stat_saved __attribute__((cleanup(statLeave), unused)) = statEnter(op)
+/** Adds n to a counter field (an opstats_t member name) of operation op. */
+#define STAT_ADD(op, field, n) statAdd(op, offsetof(opstats_t, field), (n))
+#else
+#define STAT_OP(op) ((void)0)
+#define STAT_ADD(op, field, n) ((void)(n))
+#endif
+
+#endif /* STATS_H */
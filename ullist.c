@@ -0,0 +1,291 @@
+/**
+ * Unrolled linked list library
+ * @file ullist.c
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "ullist.h"
+#include "simd.h"
+
+// Allocates an empty unrolled node.
+static ulnode_t* newNode(void) {
+    ulnode_t* node = malloc(sizeof(ulnode_t));
+    if (node == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for unrolled node\n");
+        return NULL;
+    }
+    node->next = NULL;
+    node->count = 0;
+    return node;
+}
+
+// Initialises an unrolled list to an empty list.
+void ulInit(ullist_t* list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+}
+
+// Adds an element to the head of an unrolled list.
+int ulPush(ullist_t* list, int data) {
+    ulnode_t* node = list->head;
+    // Start a new head node when the current one is full
+    if (node == NULL || node->count == ULLIST_CAPACITY) {
+        node = newNode();
+        if (node == NULL) return 1;
+        node->next = list->head;
+        list->head = node;
+        if (list->tail == NULL) list->tail = node;
+    }
+    // Shift the block right by one to make room at the front
+    memmove(&node->data[1], &node->data[0], sizeof(int) * node->count);
+    node->data[0] = data;
+    node->count++;
+    list->length++;
+    return 0;
+}
+
+// Adds an element to the tail of an unrolled list.
+int ulEnqueue(ullist_t* list, int data) {
+    ulnode_t* node = list->tail;
+    if (node == NULL || node->count == ULLIST_CAPACITY) {
+        node = newNode();
+        if (node == NULL) return 1;
+        if (list->tail == NULL) list->head = node;
+        else list->tail->next = node;
+        list->tail = node;
+    }
+    node->data[node->count++] = data;
+    list->length++;
+    return 0;
+}
+
+// Removes the element at the head of an unrolled list.
+int ulPop(ullist_t* list) {
+    ulnode_t* node = list->head;
+    if (node == NULL) {
+        fprintf(stderr, "Error: Cannot pop empty list.\n");
+        return 1;
+    }
+
+    node->count--;
+    if (node->count == 0) {         // Free the head node once it is empty
+        list->head = node->next;
+        if (list->head == NULL) list->tail = NULL;
+        free(node);
+    }
+    else {
+        memmove(&node->data[0], &node->data[1], sizeof(int) * node->count);
+    }
+    list->length--;
+    return 0;
+}
+
+// Deletes all elements with a matching value in an unrolled list.
+void ulDeleteMatch(ullist_t* list, int value) {
+    ulnode_t** link = &list->head;
+    ulnode_t* last = NULL;
+
+    while (*link != NULL) {
+        ulnode_t* node = *link;
+        int kept = 0;
+        for (int i = 0; i < node->count; i++) {     // Compact the block in place
+            if (node->data[i] != value) {
+                node->data[kept++] = node->data[i];
+            }
+        }
+        list->length -= node->count - kept;
+        node->count = kept;
+
+        if (kept == 0) {            // Unlink nodes left empty
+            *link = node->next;
+            free(node);
+        }
+        else {
+            last = node;
+            link = &node->next;
+        }
+    }
+    list->tail = last;
+}
+
+// Counts the number of occurences of a given value in an unrolled list.
+int ulCount(ullist_t* list, int value) {
+    int n = 0;
+    for (ulnode_t* node = list->head; node != NULL; node = node->next) {
+        n += simdCount(node->data, node->count, value);
+    }
+    return n;
+}
+
+// Finds the position of the first occurence of a value in an unrolled list.
+int ulFind(ullist_t* list, int value) {
+    int offset = 0;
+    for (ulnode_t* node = list->head; node != NULL; node = node->next) {
+        int i = simdFind(node->data, node->count, value);
+        if (i >= 0) return offset + i;
+        offset += node->count;
+    }
+    return -1;
+}
+
+// Sums all elements of an unrolled list.
+long long ulSum(ullist_t* list) {
+    long long sum = 0;
+    for (ulnode_t* node = list->head; node != NULL; node = node->next) {
+        sum += simdSum(node->data, node->count);
+    }
+    return sum;
+}
+
+// Finds the smallest element of an unrolled list.
+int ulMin(ullist_t* list, int* min) {
+    if (list->head == NULL) {
+        fprintf(stderr, "Cannot use min function in empty list\n");
+        return 1;
+    }
+    *min = simdMin(list->head->data, list->head->count);
+    for (ulnode_t* node = list->head->next; node != NULL; node = node->next) {
+        int value = simdMin(node->data, node->count);
+        if (value < *min) *min = value;
+    }
+    return 0;
+}
+
+// Finds the largest element of an unrolled list.
+int ulMax(ullist_t* list, int* max) {
+    if (list->head == NULL) {
+        fprintf(stderr, "Cannot use max function in empty list\n");
+        return 1;
+    }
+    *max = simdMax(list->head->data, list->head->count);
+    for (ulnode_t* node = list->head->next; node != NULL; node = node->next) {
+        int value = simdMax(node->data, node->count);
+        if (value > *max) *max = value;
+    }
+    return 0;
+}
+
+// Returns the number of elements in an unrolled list.
+int ulLength(ullist_t* list) {
+    return list->length;
+}
+
+// Reverses the order of an unrolled list.
+void ulReverse(ullist_t* list) {
+    ulnode_t* ptr = list->head;
+    ulnode_t* prv = NULL;
+    list->tail = ptr;
+
+    while (ptr != NULL) {
+        // Reverse the elements within the block
+        for (int i = 0, j = ptr->count - 1; i < j; i++, j--) {
+            int temp = ptr->data[i];
+            ptr->data[i] = ptr->data[j];
+            ptr->data[j] = temp;
+        }
+        // Reverse the link between blocks
+        ulnode_t* next = ptr->next;
+        ptr->next = prv;
+        prv = ptr;
+        ptr = next;
+    }
+    list->head = prv;
+}
+
+// Comparison function for qsort.
+static int compareInt(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Sorts an unrolled list in ascending order.
+int ulSort(ullist_t* list) {
+    if (list->length < 2) return 0;
+
+    int* arr = malloc(sizeof(int) * list->length);
+    if (arr == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed in ulSort\n");
+        return 1;
+    }
+    ulToArray(list, arr);
+    qsort(arr, list->length, sizeof(int), compareInt);
+
+    // Write back in place, keeping the existing node blocks
+    int i = 0;
+    for (ulnode_t* node = list->head; node != NULL; node = node->next) {
+        memcpy(node->data, &arr[i], sizeof(int) * node->count);
+        i += node->count;
+    }
+    free(arr);
+    return 0;
+}
+
+// Prints all elements of an unrolled list.
+void ulPrint(ullist_t* list) {
+    if (list->head == NULL) {
+        printf("Empty list");
+        return;
+    }
+    for (ulnode_t* node = list->head; node != NULL; node = node->next) {
+        for (int i = 0; i < node->count; i++) {
+            printf("-%d", node->data[i]);
+        }
+    }
+    printf("\n");
+}
+
+// Destroys an unrolled list, deallocating all nodes.
+void ulDestroy(ullist_t* list) {
+    while (list->head != NULL) {
+        ulnode_t* delete = list->head;
+        list->head = list->head->next;
+        free(delete);
+    }
+    ulInit(list);
+}
+
+// Appends the elements of an array to the tail of an unrolled list.
+int ulFromArray(ullist_t* list, int arr[], int size) {
+    for (int i = 0; i < size; i++) {
+        if (ulEnqueue(list, arr[i])) return 1;
+    }
+    return 0;
+}
+
+// Copies the elements of an unrolled list into an array.
+int ulToArray(ullist_t* list, int arr[]) {
+    int i = 0;
+    for (ulnode_t* node = list->head; node != NULL; node = node->next) {
+        memcpy(&arr[i], node->data, sizeof(int) * node->count);
+        i += node->count;
+    }
+    return i;
+}
+
+// Appends the elements of a linked list to the tail of an unrolled list.
+int ulFromList(ullist_t* list, node_t* head) {
+    while (head != NULL) {
+        if (ulEnqueue(list, head->data)) return 1;
+        head = head->next;
+    }
+    return 0;
+}
+
+// Creates a linked list containing the elements of an unrolled list.
+node_t* ulToList(ullist_t* list) {
+    sllist_t out;
+    initList(&out);
+    for (ulnode_t* node = list->head; node != NULL; node = node->next) {
+        for (int i = 0; i < node->count; i++) {
+            if (listEnqueue(&out, node->data[i])) {
+                listDestroy(&out);
+                return NULL;
+            }
+        }
+    }
+    return out.head;
+}
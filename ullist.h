@@ -0,0 +1,181 @@
+/**
+ * Unrolled linked list library
+ * @file ullist.h
+ * Each node stores a cache-line-sized block of ints, so traversals touch one
+ * pointer per block instead of one per element.
+*/
+
+#ifndef ULLIST_H
+#define ULLIST_H
+
+#include "sllist.h"
+
+/**
+ * Number of ints stored per node. With the next pointer and fill count,
+ * the default of 13 makes each node exactly one 64-byte cache line.
+*/
+#ifndef ULLIST_CAPACITY
+#define ULLIST_CAPACITY 13
+#endif
+
+/**
+ * A struct representing a node in an unrolled linked list.
+*/
+typedef struct ulnode {
+    struct ulnode* next;            /**< A pointer to the next node in the list */
+    int count;                      /**< Number of ints stored in this node */
+    int data[ULLIST_CAPACITY];      /**< Integer data stored in the node, in list order */
+} ulnode_t;
+
+/**
+ * A struct representing an unrolled linked list.
+*/
+typedef struct ullist {
+    ulnode_t* head;     /**< A pointer to the first node of the list */
+    ulnode_t* tail;     /**< A pointer to the last node of the list */
+    int length;         /**< Total number of elements in the list */
+} ullist_t;
+
+/**
+ * @brief Initialises an unrolled list to an empty list.
+ * @param list A pointer to the unrolled list.
+ */
+void ulInit(ullist_t* list);
+
+/**
+ * @brief Adds an element to the head of an unrolled list.
+ * @param list A pointer to the unrolled list.
+ * @param data An integer data to be stored.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int ulPush(ullist_t* list, int data);
+
+/**
+ * @brief Adds an element to the tail of an unrolled list.
+ * @param list A pointer to the unrolled list.
+ * @param data An integer data to be stored.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int ulEnqueue(ullist_t* list, int data);
+
+/**
+ * @brief Removes the element at the head of an unrolled list.
+ * @param list A pointer to the unrolled list.
+ * @return 0 upon successful completion, 1 otherwise
+ */
+int ulPop(ullist_t* list);
+
+/**
+ * @brief Deletes all elements with a matching value in an unrolled list.
+ * Nodes are compacted in place and nodes left empty are freed.
+ * @param list A pointer to the unrolled list.
+ * @param value The value to be deleted from the list.
+ */
+void ulDeleteMatch(ullist_t* list, int value);
+
+/**
+ * @brief Counts the number of occurences of a given value in an unrolled list.
+ * Each block is scanned with the vectorised kernels from simd.h.
+ * @param list A pointer to the unrolled list.
+ * @param value The value to search for in the list.
+ * @return Number of occurences of the value in the list.
+ */
+int ulCount(ullist_t* list, int value);
+
+/**
+ * @brief Finds the position of the first occurence of a value in an unrolled list.
+ * @param list A pointer to the unrolled list.
+ * @param value The value to search for in the list.
+ * @return The zero-based position of the value, or -1 if it is not found.
+ */
+int ulFind(ullist_t* list, int value);
+
+/**
+ * @brief Sums all elements of an unrolled list.
+ * @param list A pointer to the unrolled list.
+ * @return The sum of all elements, 0 for an empty list.
+ */
+long long ulSum(ullist_t* list);
+
+/**
+ * @brief Finds the smallest element of an unrolled list.
+ * @param list A pointer to the unrolled list.
+ * @param min A pointer to where the smallest element is stored.
+ * @return 0 upon successful completion, 1 if the list is empty.
+ */
+int ulMin(ullist_t* list, int* min);
+
+/**
+ * @brief Finds the largest element of an unrolled list.
+ * @param list A pointer to the unrolled list.
+ * @param max A pointer to where the largest element is stored.
+ * @return 0 upon successful completion, 1 if the list is empty.
+ */
+int ulMax(ullist_t* list, int* max);
+
+/**
+ * @brief Returns the number of elements in an unrolled list.
+ * @param list A pointer to the unrolled list.
+ * @return An integer representing the number of elements in the list.
+ */
+int ulLength(ullist_t* list);
+
+/**
+ * @brief Reverses the order of an unrolled list.
+ * @param list A pointer to the unrolled list.
+ */
+void ulReverse(ullist_t* list);
+
+/**
+ * @brief Sorts an unrolled list in ascending order.
+ * The elements are sorted in a temporary array and written back, filling each node.
+ * @param list A pointer to the unrolled list.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int ulSort(ullist_t* list);
+
+/**
+ * @brief Prints all elements of an unrolled list, in the same format as printList().
+ * @param list A pointer to the unrolled list.
+ */
+void ulPrint(ullist_t* list);
+
+/**
+ * @brief Destroys an unrolled list, deallocating all nodes and resetting it to empty.
+ * @param list A pointer to the unrolled list.
+ */
+void ulDestroy(ullist_t* list);
+
+/**
+ * @brief Appends the elements of an array to the tail of an unrolled list.
+ * @param list A pointer to the unrolled list.
+ * @param arr An integer array containing the data to be added.
+ * @param size An integer representing the size of the array.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int ulFromArray(ullist_t* list, int arr[], int size);
+
+/**
+ * @brief Copies the elements of an unrolled list into an array.
+ * @param list A pointer to the unrolled list.
+ * @param arr An integer array with room for ulLength(list) elements.
+ * @return The number of elements copied.
+ */
+int ulToArray(ullist_t* list, int arr[]);
+
+/**
+ * @brief Appends the elements of a linked list to the tail of an unrolled list.
+ * @param list A pointer to the unrolled list.
+ * @param head A pointer to the head node of the linked list.
+ * @return Returns 0 upon successful completion. 1 upon memory allocation failure.
+ */
+int ulFromList(ullist_t* list, node_t* head);
+
+/**
+ * @brief Creates a linked list containing the elements of an unrolled list.
+ * @param list A pointer to the unrolled list.
+ * @return Returns a pointer to the head of created linked list or NULL if empty or error
+ */
+node_t* ulToList(ullist_t* list);
+
+#endif /* ULLIST_H */